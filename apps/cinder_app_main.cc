@@ -8,7 +8,7 @@
 using boid_sim::visualizer::BoidSimApp;
 
 void prepareSettings(BoidSimApp::Settings *settings) {
-  settings->setResizable(false);
+  settings->setResizable(true);
 }
 
 CINDER_APP(BoidSimApp, ci::app::RendererGl, prepareSettings);
\ No newline at end of file
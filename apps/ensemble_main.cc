@@ -0,0 +1,143 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "headless/ensemble_runner.h"
+
+using boid_sim::headless::EnsembleGrid;
+using boid_sim::headless::EnsembleRunner;
+using boid_sim::headless::EnsembleSettings;
+
+namespace {
+
+const char *kUsage =
+    "Usage: boid-ensemble [options]\n"
+    "  Lists are comma separated; every combination becomes one run.\n"
+    "  --align LIST        alignment weights\n"
+    "  --cohesion LIST     cohesion weights\n"
+    "  --separation LIST   separation weights\n"
+    "  --fov LIST          vision radii\n"
+    "  --speed LIST        max speeds\n"
+    "  --boids LIST        boid counts\n"
+    "  --frames N          frames per run\n"
+    "  --replicas N        seeds per combination\n"
+    "  --seed N            first seed\n"
+    "  --width N           container width\n"
+    "  --height N          container height\n"
+    "  --threads N         worker threads, 0 for every core\n"
+    "  --out PATH          CSV output, stdout if left out\n";
+
+template <typename T> std::vector<T> ParseList(const std::string &text) {
+  std::vector<T> values;
+  std::stringstream stream(text);
+  std::string item;
+
+  while (std::getline(stream, item, ',')) {
+    std::stringstream item_stream(item);
+    T value;
+
+    if (!(item_stream >> value)) {
+      throw std::invalid_argument("Could not parse value \"" + item + "\"");
+    }
+
+    values.push_back(value);
+  }
+
+  if (values.empty()) {
+    throw std::invalid_argument("Empty list \"" + text + "\"");
+  }
+
+  return values;
+}
+
+template <typename T> T ParseValue(const std::string &text) {
+  std::vector<T> values = ParseList<T>(text);
+
+  if (values.size() != 1) {
+    throw std::invalid_argument("Expected a single value, got \"" + text +
+                                "\"");
+  }
+
+  return values[0];
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  EnsembleGrid grid;
+  EnsembleSettings settings;
+  std::string out_path;
+
+  try {
+    for (int i = 1; i < argc; i++) {
+      std::string flag = argv[i];
+
+      if (flag == "--help") {
+        std::cout << kUsage;
+        return 0;
+      } else if (i + 1 >= argc) {
+        throw std::invalid_argument("Missing value for " + flag);
+      }
+
+      std::string value = argv[++i];
+
+      if (flag == "--align") {
+        grid.align_percents = ParseList<float>(value);
+      } else if (flag == "--cohesion") {
+        grid.cohesion_percents = ParseList<float>(value);
+      } else if (flag == "--separation") {
+        grid.separation_percents = ParseList<float>(value);
+      } else if (flag == "--fov") {
+        grid.fov_radii = ParseList<float>(value);
+      } else if (flag == "--speed") {
+        grid.max_speeds = ParseList<float>(value);
+      } else if (flag == "--boids") {
+        grid.boid_counts = ParseList<size_t>(value);
+      } else if (flag == "--frames") {
+        settings.num_frames = ParseValue<size_t>(value);
+      } else if (flag == "--replicas") {
+        settings.num_replicas = ParseValue<size_t>(value);
+      } else if (flag == "--seed") {
+        settings.spawn_options.seed = ParseValue<uint64_t>(value);
+      } else if (flag == "--width") {
+        settings.container_width = ParseValue<size_t>(value);
+      } else if (flag == "--height") {
+        settings.container_height = ParseValue<size_t>(value);
+      } else if (flag == "--threads") {
+        settings.num_threads = ParseValue<size_t>(value);
+      } else if (flag == "--out") {
+        out_path = value;
+      } else {
+        throw std::invalid_argument("Unknown option " + flag);
+      }
+    }
+  } catch (const std::invalid_argument &error) {
+    std::cerr << error.what() << "\n" << kUsage;
+    return 1;
+  }
+
+  EnsembleRunner runner(grid, settings);
+  std::cerr << "Running " << runner.runs().size() << " simulations of "
+            << settings.num_frames << " frames\n";
+
+  std::vector<boid_sim::headless::RunSummary> summaries = runner.Run();
+
+  if (out_path.empty()) {
+    EnsembleRunner::WriteCsv(std::cout, summaries);
+  } else {
+    std::ofstream out(out_path);
+
+    if (!out) {
+      std::cerr << "Could not open " << out_path << "\n";
+      return 1;
+    }
+
+    EnsembleRunner::WriteCsv(out, summaries);
+  }
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "core/shared_state.h"
+
+using boid_sim::BoidRecord;
+using boid_sim::SharedFrame;
+using boid_sim::SharedStateReader;
+
+namespace {
+
+const char *kUsage =
+    "Usage: boid-state-reader [options]\n"
+    "  Follows a simulation publishing its frames to shared memory, and\n"
+    "  prints a line of statistics for every new frame it sees.\n"
+    "  --name NAME         shared memory name, /boid-sim if left out\n"
+    "  --frames N          frames to print before stopping, 0 for no limit\n"
+    "  --interval-ms N     time between polls for a new frame\n";
+
+template <typename T> T ParseValue(const std::string &text) {
+  std::stringstream stream(text);
+  T value;
+
+  if (!(stream >> value) || !stream.eof()) {
+    throw std::invalid_argument("Could not parse value \"" + text + "\"");
+  }
+
+  return value;
+}
+
+void PrintFrame(const SharedFrame &frame, uint64_t num_retries) {
+  double sum_x = 0.0;
+  double sum_y = 0.0;
+  double sum_speed = 0.0;
+
+  for (const BoidRecord &record : frame.boids) {
+    sum_x += record.position[0];
+    sum_y += record.position[1];
+    sum_speed += std::sqrt(record.velocity[0] * record.velocity[0] +
+                           record.velocity[1] * record.velocity[1]);
+  }
+
+  double num_boids = frame.boids.empty() ? 1.0 : (double)frame.boids.size();
+  std::cout << std::fixed << std::setprecision(2) << "frame " << frame.frame
+            << "  boids " << frame.boids.size() << "  mean position ("
+            << sum_x / num_boids << ", " << sum_y / num_boids
+            << ")  mean speed " << sum_speed / num_boids << "  retries "
+            << num_retries << "\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::string name = "/boid-sim";
+  uint64_t max_frames = 0;
+  int interval_ms = 5;
+
+  try {
+    for (int i = 1; i < argc; i++) {
+      std::string flag = argv[i];
+
+      if (flag == "--help") {
+        std::cout << kUsage;
+        return 0;
+      } else if (i + 1 >= argc) {
+        throw std::invalid_argument("Missing value for " + flag);
+      }
+
+      std::string value = argv[++i];
+
+      if (flag == "--name") {
+        name = value;
+      } else if (flag == "--frames") {
+        max_frames = ParseValue<uint64_t>(value);
+      } else if (flag == "--interval-ms") {
+        interval_ms = ParseValue<int>(value);
+      } else {
+        throw std::invalid_argument("Unknown option " + flag);
+      }
+    }
+  } catch (const std::invalid_argument &error) {
+    std::cerr << error.what() << "\n" << kUsage;
+    return 1;
+  }
+
+  std::unique_ptr<SharedStateReader> reader;
+  SharedFrame frame;
+  uint64_t num_seen = 0;
+  uint64_t num_printed = 0;
+
+  while (max_frames == 0 || num_printed < max_frames) {
+    // A writer whose swarm outgrew its segment makes a new one under the
+    // same name, so a closed segment is opened again before giving up
+    if (!reader || reader->writer_closed()) {
+      try {
+        reader.reset(new SharedStateReader(name));
+        num_seen = 0;
+      } catch (const std::runtime_error &error) {
+        if (num_printed > 0) {
+          std::cerr << "The simulation stopped publishing\n";
+          return 0;
+        }
+
+        std::cerr << error.what() << "\n";
+        return 1;
+      }
+    }
+
+    uint64_t num_published = reader->num_published();
+    if (num_published != num_seen && reader->ReadLatest(frame)) {
+      num_seen = num_published;
+      PrintFrame(frame, reader->num_retries());
+      num_printed++;
+    } else {
+      std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,46 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/basic_flock.h"
+
+/*
+ * The same number of boids at the same density per cell, once on a plane and
+ * once in a volume. A 3D boid searches 27 cells instead of 9, so each one
+ * checks more candidates for the same number of real neighbors.
+ */
+TEST_CASE("2D vs 3D Flocking", "[dimensions]") {
+  size_t num_boids = 20000;
+  float cells_per_axis_2d = 60.0f;
+  float cells_per_axis_3d = 15.3f;
+  boid_sim::FlockingParams params;
+  float cell = params.fov_radius;
+
+  std::vector<std::vector<float>> bounds_2d{{0, cells_per_axis_2d * cell},
+                                            {0, cells_per_axis_2d * cell}};
+  boid_sim::BasicFlock<2> flock_2d(
+      bounds_2d, boid_sim::SpawnBasicSwarm<2>(bounds_2d, num_boids, 3, params),
+      params);
+  flock_2d.AdvanceOnFrame();
+  WARN("2D: " << flock_2d.mean_candidates() << " candidates per boid");
+
+  BENCHMARK("2D AdvanceOnFrame") {
+    flock_2d.AdvanceOnFrame();
+    return flock_2d.boids().size();
+  };
+
+  std::vector<std::vector<float>> bounds_3d{{0, cells_per_axis_3d * cell},
+                                            {0, cells_per_axis_3d * cell},
+                                            {0, cells_per_axis_3d * cell}};
+  boid_sim::BasicFlock<3> flock_3d(
+      bounds_3d, boid_sim::SpawnBasicSwarm<3>(bounds_3d, num_boids, 3, params),
+      params);
+  flock_3d.AdvanceOnFrame();
+  WARN("3D: " << flock_3d.mean_candidates() << " candidates per boid");
+
+  BENCHMARK("3D AdvanceOnFrame") {
+    flock_3d.AdvanceOnFrame();
+    return flock_3d.boids().size();
+  };
+}
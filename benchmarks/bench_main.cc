@@ -0,0 +1,5 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
@@ -0,0 +1,60 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+#include <cmath>
+
+#include "core/basic_flock.h"
+#include "core/compact_flock.h"
+
+/*
+ * A million boids at the density of the 2D flocking benchmark, far more than
+ * fits in cache, stored as floats in a BasicFlock and quantized in a
+ * CompactFlock. Reading every position shows the memory traffic alone, and
+ * AdvanceOnFrame the whole step.
+ */
+TEST_CASE("Quantized vs Float Swarm State", "[compact]") {
+  size_t num_boids = 1000000;
+  boid_sim::FlockingParams params;
+  float side = std::sqrt((float)num_boids / 5.55f) * params.fov_radius;
+
+  std::vector<std::vector<float>> bounds{{0, side}, {0, side}};
+  std::vector<boid_sim::BasicBoid<2>> boids =
+      boid_sim::SpawnBasicSwarm<2>(bounds, num_boids, 43, params);
+  boid_sim::CompactFlock<2> compact_flock(bounds, boids, params);
+  boid_sim::BasicFlock<2> float_flock(bounds, boids, params);
+
+  size_t float_bytes = sizeof(boid_sim::BasicBoid<2>);
+  size_t compact_bytes = boid_sim::CompactFlock<2>::bytes_per_boid();
+  WARN("Bytes per boid: " << float_bytes << " as floats, " << compact_bytes
+                          << " quantized. 10M boids take "
+                          << float_bytes * 10 << " MB vs " << compact_bytes * 10
+                          << " MB");
+  WARN("Error bounds: " << compact_flock.position_error_bound()
+                        << " per position axis, "
+                        << compact_flock.velocity_error_bound()
+                        << " per velocity axis");
+
+  BENCHMARK("Read every position, float") {
+    glm::vec2 sum(0, 0);
+    for (const boid_sim::BasicBoid<2> &boid : float_flock.boids()) {
+      sum += boid.position();
+    }
+
+    return sum / (float)num_boids;
+  };
+
+  BENCHMARK("Read every position, quantized") {
+    return compact_flock.mean_position();
+  };
+
+  BENCHMARK("AdvanceOnFrame, float") {
+    float_flock.AdvanceOnFrame();
+    return float_flock.boids().size();
+  };
+
+  BENCHMARK("AdvanceOnFrame, quantized") {
+    compact_flock.AdvanceOnFrame();
+    return compact_flock.size();
+  };
+}
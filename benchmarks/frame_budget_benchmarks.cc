@@ -0,0 +1,34 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/frame_budget_controller.h"
+#include "visualizer/boid_container.h"
+
+/*
+ * A tightly clustered swarm, where every boid sees hundreds of others,
+ * stepped at each level of the frame budget ladder.
+ */
+TEST_CASE("Frame Budget Levels", "[budget]") {
+  boid_sim::SpawnOptions options;
+  options.seed = 40;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+  options.cluster_spread = .02f;
+  glm::vec2 mouse_pos(0, 0);
+
+  boid_sim::visualizer::BoidContainer compressed(1500, 900, 5000, options);
+  compressed.AdvanceOnFrame(mouse_pos);
+
+  boid_sim::FrameBudgetController controller(16.0, 2);
+  for (size_t level = 0; level < controller.num_levels(); level++) {
+    boid_sim::visualizer::BoidContainer container = compressed;
+    container.set_fidelity(controller.SettingsForLevel(level));
+    container.AdvanceOnFrame(mouse_pos);
+
+    BENCHMARK("AdvanceOnFrame, level " + std::to_string(level)) {
+      container.AdvanceOnFrame(mouse_pos);
+      return container.frame_count();
+    };
+  }
+}
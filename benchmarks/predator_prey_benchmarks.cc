@@ -0,0 +1,67 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/spatial_grid.h"
+#include "visualizer/boid_container.h"
+
+/*
+ * 100,000 prey and 100 predators. Every boid also looks across roles, so the
+ * candidates those queries scan are counted against what the same queries
+ * would scan in one index holding both roles.
+ */
+TEST_CASE("Predator-Prey", "[predators]") {
+  boid_sim::SpawnOptions options;
+  options.seed = 39;
+  glm::vec2 mouse_pos(0, 0);
+
+  boid_sim::visualizer::BoidContainer prey_only(12000, 12000, 100000, options);
+  boid_sim::visualizer::BoidContainer container = prey_only;
+  container.AddPredators(100);
+  container.AdvanceOnFrame(mouse_pos);
+
+  const std::vector<boid_sim::Boid> &boids = container.boids();
+  const boid_sim::FlockingParams &params = container.flocking_params();
+  size_t num_prey = boids.size() - container.num_predators();
+
+  std::vector<glm::vec2> positions;
+  std::vector<glm::vec2> predator_positions;
+  for (size_t i = 0; i < boids.size(); i++) {
+    positions.push_back(boids[i].position());
+    if (i >= num_prey) {
+      predator_positions.push_back(boids[i].position());
+    }
+  }
+
+  boid_sim::SpatialGrid mixed_grid;
+  mixed_grid.Build(positions, container.container_bounds(), params.fov_radius);
+  boid_sim::SpatialGrid predator_grid;
+  predator_grid.Build(predator_positions, container.container_bounds(),
+                      params.flee_radius);
+
+  std::vector<size_t> candidates;
+  size_t mixed_flee = 0;
+  size_t typed_flee = 0;
+  for (size_t i = 0; i < num_prey; i++) {
+    mixed_grid.Gather(positions[i], params.flee_radius, candidates);
+    mixed_flee += candidates.size();
+    predator_grid.Gather(positions[i], params.flee_radius, candidates);
+    typed_flee += candidates.size();
+  }
+
+  WARN("Flee query, candidates per prey: " << (double)mixed_flee / num_prey
+                                           << " mixed, "
+                                           << (double)typed_flee / num_prey
+                                           << " predator index");
+
+  BENCHMARK("AdvanceOnFrame, 100000 prey") {
+    prey_only.AdvanceOnFrame(mouse_pos);
+    return prey_only.frame_count();
+  };
+
+  BENCHMARK("AdvanceOnFrame, 100000 prey and 100 predators") {
+    container.AdvanceOnFrame(mouse_pos);
+    return container.frame_count();
+  };
+}
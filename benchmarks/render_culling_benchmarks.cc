@@ -0,0 +1,54 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cmath>
+
+#include "visualizer/boid_container.h"
+#include "visualizer/camera_2d.h"
+
+/*
+ * The same 800x600 view of swarms of growing size, spread over worlds of
+ * growing size so the density stays the same. Culling walks the index cells
+ * in view, so zoomed in it costs about the same for every swarm. Zoomed all
+ * the way out the density texture adds up cell counts, which grows with the
+ * cells on screen but never looks at a boid.
+ */
+TEST_CASE("Render Culling", "[render]") {
+  boid_sim::SpawnOptions options;
+  options.seed = 5;
+  glm::vec2 mouse_pos(0, 0);
+  glm::vec2 viewport(800, 600);
+
+  for (size_t num_boids : {10000, 100000, 1000000}) {
+    size_t side = (size_t)(20.0 * std::sqrt((double)num_boids));
+    boid_sim::visualizer::BoidContainer container(side, side, num_boids,
+                                                  options);
+    container.AdvanceOnFrame(mouse_pos);
+
+    glm::vec2 center(side / 2.0f, side / 2.0f);
+    boid_sim::visualizer::RenderBatch batch;
+    std::string swarm = std::to_string(num_boids) + " boids";
+
+    boid_sim::visualizer::Camera2D zoomed_in(viewport, center, 1.0f);
+    container.CullForCamera(zoomed_in, batch);
+    WARN(swarm << ": " << batch.boids.size() << " boids drawn zoomed in");
+
+    BENCHMARK("Triangles in view, " + swarm) {
+      container.CullForCamera(zoomed_in, batch);
+      return batch.boids.size();
+    };
+
+    // Fits the whole world on screen, far enough out for a density texture
+    boid_sim::visualizer::Camera2D zoomed_out(
+        viewport, center, std::min(600.0f / side, 0.05f));
+    container.CullForCamera(zoomed_out, batch);
+    WARN(swarm << ": " << batch.density.size() << " texels zoomed out");
+
+    BENCHMARK("Density of the whole world, " + swarm) {
+      container.CullForCamera(zoomed_out, batch);
+      return batch.density.size();
+    };
+  }
+}
@@ -0,0 +1,81 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/sparse_grid.h"
+#include "core/spatial_grid.h"
+#include "core/swarm_rng.h"
+
+namespace {
+
+const size_t kNumPositions = 20000;
+const float kCellSize = 85.0f;
+
+std::vector<glm::vec2> ScatterPositions(float world_size) {
+  boid_sim::SwarmRng rng(7);
+  std::vector<glm::vec2> positions;
+
+  for (size_t i = 0; i < kNumPositions; i++) {
+    positions.emplace_back(rng.Uniform(i, 0, 0.0f, world_size),
+                           rng.Uniform(i, 1, 0.0f, world_size));
+  }
+
+  return positions;
+}
+
+template <typename Grid>
+size_t GatherAll(const Grid &grid, const std::vector<glm::vec2> &positions,
+                 std::vector<size_t> &indices) {
+  size_t num_found = 0;
+
+  for (const glm::vec2 &position : positions) {
+    grid.Gather(position, kCellSize, indices);
+    num_found += indices.size();
+  }
+
+  return num_found;
+}
+
+} // namespace
+
+/*
+ * The same 20,000 positions spread over ever larger worlds, from every cell
+ * holding dozens of positions down to almost every cell being empty
+ */
+TEST_CASE("Dense vs Sparse Grid", "[grid]") {
+  for (float world_size : {2000.0f, 20000.0f, 200000.0f}) {
+    std::vector<glm::vec2> positions = ScatterPositions(world_size);
+    std::vector<std::vector<float>> bounds{{0, world_size}, {0, world_size}};
+    std::vector<size_t> indices;
+    std::string world = std::to_string((int)world_size) + " world";
+
+    boid_sim::SpatialGrid dense;
+    boid_sim::SparseGrid sparse;
+    dense.Build(positions, bounds, kCellSize);
+    sparse.Build(positions, kCellSize);
+
+    WARN(world << ": " << sparse.num_cells() << " of " << dense.num_cells()
+               << " cells occupied, sparse table holds "
+               << sparse.memory_bytes() << " bytes vs "
+               << dense.cell_starts().size() * sizeof(size_t) << " dense");
+
+    BENCHMARK("dense build, " + world) {
+      dense.Build(positions, bounds, kCellSize);
+      return dense.num_cells();
+    };
+
+    BENCHMARK("sparse build, " + world) {
+      sparse.Build(positions, kCellSize);
+      return sparse.num_cells();
+    };
+
+    BENCHMARK("dense gather, " + world) {
+      return GatherAll(dense, positions, indices);
+    };
+
+    BENCHMARK("sparse gather, " + world) {
+      return GatherAll(sparse, positions, indices);
+    };
+  }
+}
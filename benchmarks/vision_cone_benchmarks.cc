@@ -0,0 +1,51 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/spatial_grid.h"
+#include "visualizer/boid_container.h"
+
+/*
+ * The same 20,000 boid swarm seen through ever narrower cones. Cells entirely
+ * in a boid's blind spot are skipped, so narrower cones gather fewer
+ * candidates to check.
+ */
+TEST_CASE("Vision Cone Culling", "[cone]") {
+  boid_sim::SpawnOptions options;
+  options.seed = 11;
+  glm::vec2 mouse_pos(0, 0);
+
+  for (float view_angle : {360.0f, 270.0f, 180.0f, 120.0f}) {
+    boid_sim::FlockingParams params;
+    params.view_angle = view_angle;
+    boid_sim::visualizer::BoidContainer container(3000, 1800, 20000, options,
+                                                  params);
+
+    const std::vector<boid_sim::Boid> &boids = container.boids();
+    std::vector<glm::vec2> positions;
+    for (const boid_sim::Boid &boid : boids) {
+      positions.push_back(boid.position());
+    }
+
+    boid_sim::SpatialGrid grid;
+    grid.Build(positions, container.container_bounds(), params.fov_radius);
+
+    std::vector<size_t> candidates;
+    size_t num_candidates = 0;
+    for (const boid_sim::Boid &boid : boids) {
+      grid.Gather(boid.position(), boid.fov_radius(), boid.vision_cone(),
+                  candidates);
+      num_candidates += candidates.size();
+    }
+
+    std::string angle = std::to_string((int)view_angle) + " degrees";
+    WARN(angle << ": " << (double)num_candidates / boids.size()
+               << " candidates per boid");
+
+    BENCHMARK("AdvanceOnFrame, " + angle) {
+      container.AdvanceOnFrame(mouse_pos);
+      return container.frame_count();
+    };
+  }
+}
@@ -0,0 +1,129 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <vector>
+
+#include "cinder/gl/gl.h"
+
+namespace boid_sim {
+
+/**
+ * The glm vector type for a number of dimensions
+ */
+template <int Dim> struct VectorOf;
+
+template <> struct VectorOf<2> { typedef glm::vec2 type; };
+
+template <> struct VectorOf<3> { typedef glm::vec3 type; };
+
+/**
+ * Stands in for a velocity component of exactly zero, and its inverse is the
+ * massive steering that pushes a boid back out of a wall or obstacle
+ */
+const float kSteeringEpsilon = 0.00000000001f;
+
+/**
+ * Steering along one axis that keeps a boid between min_bound and max_bound.
+ * It grows as the boid nears a bound it can see, and becomes massive once the
+ * boid is past it.
+ */
+float AxisBoundsSteering(float coordinate, float min_bound, float max_bound,
+                         float fov_radius, float max_force);
+
+/**
+ * Boid in Dim dimensions following the three flocking rules, without anything
+ * needed to draw it. Every axis of the container is handled the same way, so
+ * the 2D and 3D kernels come from one implementation. Boid is BasicBoid<2>
+ * with drawing, the mouse, vision cones and obstacles added on top.
+ */
+template <int Dim> class BasicBoid {
+public:
+  typedef typename VectorOf<Dim>::type Vector;
+
+  /**
+   * Constructor for BasicBoid
+   */
+  BasicBoid(int id, const Vector &position, const Vector &direction,
+            float max_speed = 2.0f, float fov_radius = 85.0f);
+
+  /**
+   * Sums over the neighbors a boid can see, which the three flocking rules
+   * are built from
+   */
+  struct NeighborSums {
+    Vector velocity = Vector(0.0f);
+    Vector position = Vector(0.0f);
+    Vector away = Vector(0.0f);
+    size_t num_visible = 0;
+    size_t num_apart = 0;
+  };
+
+  /**
+   * Updates the position of the boid, flocking with the boids it can see in
+   * neighbors. container_bounds holds a min and max for every axis; empty
+   * bounds mean an unbounded world.
+   */
+  void UpdatePosition(const std::vector<std::vector<float>> &container_bounds,
+                      const std::vector<BasicBoid> &neighbors,
+                      float align_percent, float cohesion_percent,
+                      float separation_percent);
+
+  /**
+   * Updates the position of the boid from neighbor sums built up with
+   * AddNeighbor, for callers that do not keep their neighbors as BasicBoids
+   */
+  void UpdatePosition(const std::vector<std::vector<float>> &container_bounds,
+                      const NeighborSums &sums, float align_percent,
+                      float cohesion_percent, float separation_percent);
+
+  /**
+   * Adds a neighbor the boid can see to sums
+   */
+  void AddNeighbor(const Vector &position, const Vector &velocity,
+                   NeighborSums &sums) const;
+
+  const Vector &position() const;
+
+  void set_position(const Vector &position);
+
+  const Vector &velocity() const;
+
+  void set_velocity(const Vector &velocity);
+
+  int id() const;
+
+  float max_speed() const;
+
+  float fov_radius() const;
+
+protected:
+  int id_;
+  float max_speed_;
+  float max_force_;
+  float fov_radius_;
+  Vector position_;
+  Vector velocity_;
+
+  Vector Flock(const NeighborSums &sums, float align_percent,
+               float cohesion_percent, float separation_percent) const;
+  Vector SteerInbounds(const std::vector<std::vector<float>> &container_bounds);
+  Vector CalcSteerForce(const Vector &desired_direction) const;
+  void FixZeroComponentVelocity();
+
+  /**
+   * Adds acceleration to the velocity, limits it to the max speed and moves
+   * the boid. A time_step under 1 moves it only that fraction of a frame.
+   */
+  void Integrate(const Vector &acceleration, float time_step);
+
+private:
+  bool Sees(const BasicBoid &boid) const;
+  NeighborSums SumNeighbors(const std::vector<BasicBoid> &neighbors) const;
+};
+
+extern template class BasicBoid<2>;
+extern template class BasicBoid<3>;
+
+} // namespace boid_sim
@@ -0,0 +1,74 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/basic_boid.h"
+#include "core/basic_spatial_grid.h"
+#include "core/flocking_params.h"
+
+namespace boid_sim {
+
+/**
+ * Headless swarm of BasicBoids in Dim dimensions, stepped a frame at a time
+ * like BoidContainer. Neighbors are found with a BasicSpatialGrid and summed
+ * in id order, so a frame is bit for bit the same for any thread count.
+ */
+template <int Dim> class BasicFlock {
+public:
+  typedef typename VectorOf<Dim>::type Vector;
+
+  /**
+   * Constructor for BasicFlock. container_bounds holds a min and max for every
+   * axis, or is empty for an unbounded world.
+   */
+  BasicFlock(const std::vector<std::vector<float>> &container_bounds,
+             const std::vector<BasicBoid<Dim>> &boids,
+             const FlockingParams &flocking_params = FlockingParams());
+
+  /**
+   * Updates the positions and velocities of all boids by one frame
+   */
+  void AdvanceOnFrame();
+
+  void set_num_threads(size_t num_threads);
+
+  size_t num_threads() const;
+
+  /**
+   * Average number of boids each boid had to check on the last frame, before
+   * the exact distance test
+   */
+  double mean_candidates() const;
+
+  const std::vector<BasicBoid<Dim>> &boids() const;
+
+  const std::vector<std::vector<float>> &container_bounds() const;
+
+private:
+  std::vector<std::vector<float>> container_bounds_;
+  FlockingParams flocking_params_;
+  std::vector<BasicBoid<Dim>> boids_;
+  size_t num_threads_ = 1;
+  BasicSpatialGrid<Dim> grid_;
+  std::vector<Vector> positions_;
+  std::vector<size_t> candidate_counts_;
+};
+
+/**
+ * Spreads num_boids boids uniformly over the container, heading in random
+ * directions. The same seed always gives the same swarm.
+ */
+template <int Dim>
+std::vector<BasicBoid<Dim>>
+SpawnBasicSwarm(const std::vector<std::vector<float>> &container_bounds,
+                size_t num_boids, uint64_t seed,
+                const FlockingParams &flocking_params = FlockingParams());
+
+extern template class BasicFlock<2>;
+extern template class BasicFlock<3>;
+
+} // namespace boid_sim
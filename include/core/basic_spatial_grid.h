@@ -0,0 +1,115 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "core/basic_boid.h"
+
+namespace boid_sim {
+
+/**
+ * Uniform grid of cells in Dim dimensions, rebuilt from the boid positions
+ * every frame. SpatialGrid is the 2D grid with a few 2D-only queries on top.
+ * A search radius of one cell covers a block of 3 x 3 cells in 2D but
+ * 3 x 3 x 3 in 3D, which is why 3D swarms have so many more candidates to
+ * check. Positions outside of the container are kept in the closest edge
+ * cell.
+ */
+template <int Dim> class BasicSpatialGrid {
+public:
+  typedef typename VectorOf<Dim>::type Vector;
+
+  /**
+   * Constructor for BasicSpatialGrid
+   */
+  BasicSpatialGrid();
+
+  /**
+   * Copy constructor
+   */
+  BasicSpatialGrid(const BasicSpatialGrid &source);
+
+  /**
+   * Copy assignment operator
+   */
+  BasicSpatialGrid &operator=(const BasicSpatialGrid &source);
+
+  /**
+   * Buckets the positions into cells. With empty container bounds, the grid
+   * covers the box around the positions instead. Cells grow past cell_size
+   * if the world would otherwise need more than max(65536, 64 per position)
+   * of them. On one thread every cell
+   * keeps its positions in ascending index order. With more than one thread,
+   * positions are scattered into their cells concurrently, so the order of
+   * indices inside a cell depends on scheduling.
+   */
+  void Build(const std::vector<Vector> &positions,
+             const std::vector<std::vector<float>> &container_bounds,
+             float cell_size, size_t num_threads = 1);
+
+  /**
+   * Fills indices with every position stored in the cells that overlap the
+   * box around center. Callers still need to check the exact distance.
+   */
+  void Gather(const Vector &center, float radius,
+              std::vector<size_t> &indices) const;
+
+  size_t CellOf(const Vector &position) const;
+
+  /**
+   * Cell coordinate of value along an axis, clamped into the grid
+   */
+  size_t CoordinateOf(float value, int axis) const;
+
+  /**
+   * Indices of the positions stored in a cell are
+   * entries()[cell_starts()[cell]] up to entries()[cell_starts()[cell + 1]]
+   */
+  const std::vector<size_t> &cell_starts() const;
+
+  const std::vector<size_t> &entries() const;
+
+  /**
+   * Number of cells along an axis
+   */
+  size_t cells_along(int axis) const;
+
+  size_t num_cells() const;
+
+  float cell_size() const;
+
+  /**
+   * Corner of the first cell
+   */
+  const Vector &origin() const;
+
+protected:
+  /**
+   * Constructor for a grid that keeps cell_size however many cells the world
+   * needs, for callers that already pick a different index for huge worlds
+   */
+  explicit BasicSpatialGrid(bool limit_cells);
+
+private:
+  bool limit_cells_;
+  Vector origin_;
+  float cell_size_;
+  size_t cells_along_[Dim];
+  size_t strides_[Dim];
+  std::vector<size_t> cell_of_;
+  std::vector<size_t> cell_starts_;
+  std::vector<size_t> entries_;
+  // Kept between builds so a steady-state build does not allocate
+  std::vector<size_t> cursors_;
+  std::unique_ptr<std::atomic<size_t>[]> atomic_cursors_;
+  size_t atomic_cursors_size_;
+};
+
+extern template class BasicSpatialGrid<2>;
+extern template class BasicSpatialGrid<3>;
+
+} // namespace boid_sim
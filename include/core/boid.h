@@ -3,11 +3,53 @@
 //
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "cinder/gl/gl.h"
+#include "core/basic_boid.h"
+#include "core/obstacle_field.h"
+#include "core/vision_cone.h"
 
 namespace boid_sim {
 
-class Boid {
+/**
+ * What a boid is in a predator-prey world. Prey flock together and flee from
+ * predators; predators flock together and chase the nearest prey.
+ */
+enum class BoidRole { kPrey, kPredator };
+
+class Boid;
+
+/**
+ * Read-only view of boids that lie next to each other in memory, such as a
+ * vector of boids with any allocator
+ */
+class BoidSpan {
+public:
+  template <typename Allocator>
+  BoidSpan(const std::vector<Boid, Allocator> &boids)
+      : data_(boids.data()), size_(boids.size()) {}
+
+  const Boid *begin() const;
+
+  const Boid *end() const;
+
+  size_t size() const { return size_; }
+
+  const Boid &operator[](size_t index) const;
+
+private:
+  const Boid *data_;
+  size_t size_;
+};
+
+/**
+ * BasicBoid<2> that can be drawn, seek the mouse, see in a cone, steer around
+ * obstacles and play a role in a predator-prey world. The flocking rules
+ * themselves all come from BasicBoid.
+ */
+class Boid : public BasicBoid<2> {
 public:
   /**
    * Constructor for Boid
@@ -16,69 +58,115 @@ public:
        float max_speed = 2.0f, float fov_radius = 85.0f,
        float body_radius_ = 6.0f);
 
+  friend bool operator!=(const Boid &boid1, const Boid &boid2);
+
   /**
-   * Copy assignment constructor
+   * Updates the position coordinates of the boid. Empty container bounds mean
+   * an unbounded world, where the boid is never steered back inside.
+   * external_force is extra steering from outside the flock, like fleeing a
+   * predator, added before the speed is limited. A time_step under 1 moves
+   * the boid only that fraction of a frame.
    */
-  Boid &operator=(const Boid &source);
+  void UpdatePosition(std::vector<std::vector<float>> &container_bounds,
+                      BoidSpan boids, glm::vec2 &mouse_pos,
+                      float align_percent, float cohesion_percent,
+                      float separation_percent,
+                      const glm::vec2 &external_force = glm::vec2(0, 0),
+                      float time_step = 1.0f);
 
-  friend bool operator!=(const Boid &boid1, const Boid &boid2);
+  /**
+   * Updates the position coordinates of the boid, steering it away from the
+   * obstacles (and walls) baked into the field instead of the container bounds
+   */
+  void UpdatePosition(const ObstacleField &obstacle_field,
+                      BoidSpan boids, glm::vec2 &mouse_pos,
+                      float align_percent, float cohesion_percent,
+                      float separation_percent,
+                      const glm::vec2 &external_force = glm::vec2(0, 0),
+                      float time_step = 1.0f);
 
   /**
-   * Updates the position coordinates of the boid
+   * Same as the overloads above, from neighbor sums built up with
+   * AddNeighbor by a caller that has already found the boids this one sees,
+   * so they never have to be copied out
    */
   void UpdatePosition(std::vector<std::vector<float>> &container_bounds,
-                      std::vector<Boid> &boids, glm::vec2 &mouse_pos,
+                      const NeighborSums &sums, glm::vec2 &mouse_pos,
                       float align_percent, float cohesion_percent,
-                      float separation_percent);
+                      float separation_percent,
+                      const glm::vec2 &external_force = glm::vec2(0, 0),
+                      float time_step = 1.0f);
+
+  void UpdatePosition(const ObstacleField &obstacle_field,
+                      const NeighborSums &sums, glm::vec2 &mouse_pos,
+                      float align_percent, float cohesion_percent,
+                      float separation_percent,
+                      const glm::vec2 &external_force = glm::vec2(0, 0),
+                      float time_step = 1.0f);
+
+  /**
+   * Steering force towards a target, the same one used to seek the mouse but
+   * at any distance
+   */
+  glm::vec2 Pursue(const glm::vec2 &target);
+
+  /**
+   * Steering force straight away from a threat
+   */
+  glm::vec2 Flee(const glm::vec2 &threat);
 
   /**
    * Draws boid to the screen
    */
   void Draw();
 
-  const glm::vec2 &position() const;
+  bool is_seek_mouse() const;
+  
+  void set_seek_mouse(bool seek_mouse);
 
-  void set_position(const glm::vec2 &position);
+  float body_radius() const;
 
-  const glm::vec2 &velocity() const;
+  /**
+   * Width in degrees of the cone the boid sees other boids in, centered on
+   * its heading. Boids start out seeing all 360 degrees around them.
+   */
+  void set_view_angle(float view_angle);
 
-  void set_velocity(const glm::vec2 &velocity);
+  float view_angle() const;
 
-  bool is_seek_mouse() const;
-  
-  void set_seek_mouse(bool seek_mouse);
+  void set_role(BoidRole role);
 
-private:
-  const float kEpsilon = 0.00000000001f;
+  BoidRole role() const;
+
+  /**
+   * The cone of vision at the boid's current position and heading, the same
+   * one used to decide which boids it flocks with
+   */
+  VisionCone vision_cone() const;
 
+private:
   // how far away each triangle vertex is from the center of boid
   float body_radius_;
-  float max_speed_;
-  float max_force_;
-  float fov_radius_;
-  int id_;
+  float view_angle_;
   bool seek_mouse_;
-  glm::vec2 position_;
-  glm::vec2 velocity_;
-
-  std::vector<glm::vec2> CalculateVertices();
-  glm::vec2 SteerInbounds(std::vector<std::vector<float>> &container_bounds);
-  glm::vec2 Flock(std::vector<Boid> &boids, glm::vec2 &mouse_pos,
-                  float align_percent, float cohesion_percent,
-                  float separation_percent);
-  glm::vec2 Align(std::vector<Boid> &boids);
-  glm::vec2 Cohesion(std::vector<Boid> &boids);
-  glm::vec2 Separation(std::vector<Boid> &boids);
+  BoidRole role_;
+
+  std::array<glm::vec2, 3> CalculateVertices();
+  glm::vec2 AvoidObstacles(const ObstacleField &obstacle_field);
+  void Move(glm::vec2 &acceleration, glm::vec2 &mouse_pos,
+            const glm::vec2 &external_force, float time_step);
   glm::vec2 Seek(glm::vec2 &desired_position);
-  glm::vec2 CalcSteerForce(glm::vec2 &desired_direction);
-  std::vector<Boid> GetBoidsInVision(const std::vector<Boid> &boids);
-  void FixZeroComponentVelocity();
-  float HandleHorizontalBounds(
-      std::vector<std::vector<float>> &container_bounds) const;
-  float
-  HandleVerticalBounds(std::vector<std::vector<float>> &container_bounds) const;
+  NeighborSums SumBoidsInVision(BoidSpan boids) const;
   float GetVelocityAngle();
-  void ValidateValues(float max_speed, float fov_radius, float body_radius);
+  void ValidateValues(float body_radius);
 };
 
+inline const Boid *BoidSpan::begin() const { return data_; }
+
+inline const Boid *BoidSpan::end() const { return data_ + size_; }
+
+inline const Boid &BoidSpan::operator[](size_t index) const {
+  return data_[index];
+}
+
 } // namespace boid_sim
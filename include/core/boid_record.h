@@ -0,0 +1,46 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/boid.h"
+
+namespace boid_sim {
+
+/**
+ * Plain, fixed-layout copy of a boid's state that can be written byte for byte
+ * to a file, a socket or shared memory and read back on the other side.
+ */
+struct BoidRecord {
+  int32_t id;
+  float position[2];
+  float velocity[2];
+  float max_speed;
+  float fov_radius;
+  float body_radius;
+  float view_angle;
+  int32_t seek_mouse;
+  int32_t role;
+};
+
+/**
+ * Captures the full state of a boid into a record
+ */
+BoidRecord ToRecord(const Boid &boid);
+
+/**
+ * Rebuilds a boid that is identical to the one the record was taken from
+ */
+Boid FromRecord(const BoidRecord &record);
+
+/**
+ * Hashes the exact bits of every boid's state, in order. Two swarms only hash
+ * the same if they are bit for bit identical, which makes it easy to compare
+ * replays.
+ */
+uint64_t HashSwarm(const std::vector<Boid> &boids);
+
+} // namespace boid_sim
@@ -0,0 +1,77 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/boid.h"
+#include "core/flocking_params.h"
+#include "core/frame_budget_controller.h"
+#include "core/swarm_rng.h"
+
+namespace boid_sim {
+
+/**
+ * Fixed size block at the start of every checkpoint file. The boids follow
+ * directly after it as a packed array of BoidRecords, and then the neighbor
+ * count of every boid on the last frame, which level of detail reads on the
+ * next one.
+ */
+struct CheckpointHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  float container_bounds[2][2];
+  float align_percent;
+  float cohesion_percent;
+  float separation_percent;
+  float max_speed;
+  float fov_radius;
+  float view_angle;
+  float predator_max_speed;
+  float hunt_radius;
+  float flee_radius;
+  uint32_t unbounded;
+  uint64_t rng_seed;
+  uint64_t rng_counter;
+  uint64_t frame_count;
+  uint64_t max_neighbors;
+  uint64_t substeps;
+  uint64_t lod_neighbor_threshold;
+  uint64_t far_field_neighbor_threshold;
+  uint64_t num_boids;
+  uint64_t num_neighbor_counts;
+};
+
+/**
+ * Everything a run needs besides its boids to carry on exactly where it was
+ * saved
+ */
+struct CheckpointState {
+  std::vector<std::vector<float>> container_bounds;
+  bool unbounded = false;
+  FlockingParams flocking_params;
+  FidelitySettings fidelity;
+  SwarmRng rng;
+  size_t frame_count = 0;
+};
+
+/**
+ * Writes the full simulation state to a binary checkpoint file
+ */
+void WriteCheckpoint(const std::string &path, const CheckpointState &state,
+                     const std::vector<Boid> &boids,
+                     const std::vector<size_t> &neighbor_counts);
+
+/**
+ * Maps a checkpoint file into memory and restores the simulation state from
+ * it. Throws if the file is missing, truncated or not a checkpoint.
+ */
+void ReadCheckpoint(const std::string &path, CheckpointState &state,
+                    std::vector<Boid> &boids,
+                    std::vector<size_t> &neighbor_counts);
+
+} // namespace boid_sim
@@ -0,0 +1,132 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/basic_boid.h"
+#include "core/flocking_params.h"
+
+namespace boid_sim {
+
+/**
+ * Headless swarm like BasicFlock, for swarms so big that stepping them is
+ * limited by how fast boids come in from memory rather than by the math.
+ * Boids are kept sorted by grid cell, and each one is stored as
+ * 16-bit fixed point:
+ *
+ * - Every axis of its position is an offset from the corner of its cell, in
+ *   steps of cell_size() / 65536.
+ * - Every axis of its velocity is a fraction of max_speed, in steps of
+ *   max_speed / 32767.
+ *
+ * That is 4 bytes per axis, against 32 bytes for a whole BasicBoid in 2D.
+ * Neighbors are decoded to floats only in registers while they are summed,
+ * then the same rules as BasicBoid are applied and the result is stored
+ * quantized again.
+ *
+ * Every boid has to share one max_speed and fov_radius, and the world has to
+ * be bounded. The grid keeps a ring of cells around the container for boids
+ * that stray past the bounds. A boid further out than that is clamped onto
+ * the ring, and only then is its error larger than position_error_bound().
+ */
+template <int Dim> class CompactFlock {
+public:
+  typedef typename VectorOf<Dim>::type Vector;
+
+  /**
+   * Constructor for CompactFlock, quantizing the boids. container_bounds holds
+   * a min and max for every axis.
+   */
+  CompactFlock(const std::vector<std::vector<float>> &container_bounds,
+               const std::vector<BasicBoid<Dim>> &boids,
+               const FlockingParams &flocking_params = FlockingParams());
+
+  /**
+   * Updates the positions and velocities of all boids by one frame. Every
+   * boid sums its neighbors cell by cell in storage order, so a frame is the
+   * same for any thread count.
+   */
+  void AdvanceOnFrame();
+
+  void set_num_threads(size_t num_threads);
+
+  size_t num_threads() const;
+
+  /**
+   * Decodes every boid back to floats, in id order
+   */
+  std::vector<BasicBoid<Dim>> boids() const;
+
+  size_t size() const;
+
+  /**
+   * Average position of the swarm. Every position is decoded in registers
+   * in one pass over the stored state, without decoding whole boids.
+   */
+  Vector mean_position() const;
+
+  /**
+   * Largest difference between a stored position and the position it
+   * encodes, along any axis
+   */
+  float position_error_bound() const;
+
+  /**
+   * Largest difference between a stored velocity and the velocity it
+   * encodes, along any axis
+   */
+  float velocity_error_bound() const;
+
+  /**
+   * Bytes stored per boid: its quantized state and its id
+   */
+  static size_t bytes_per_boid();
+
+  float cell_size() const;
+
+private:
+  struct PackedBoid {
+    uint16_t offset[Dim];
+    int16_t velocity[Dim];
+  };
+
+  std::vector<std::vector<float>> container_bounds_;
+  FlockingParams flocking_params_;
+  float max_speed_;
+  float fov_radius_;
+  Vector origin_;
+  float cell_size_;
+  float position_step_;
+  float velocity_step_;
+  size_t cells_along_[Dim];
+  size_t strides_[Dim];
+  size_t num_threads_ = 1;
+
+  // Boids sorted by cell, and the id of each
+  std::vector<uint32_t> cell_starts_;
+  std::vector<PackedBoid> state_;
+  std::vector<uint32_t> ids_;
+
+  // Next frame's boids, in the order of state_, and the cell each moved to
+  std::vector<PackedBoid> updated_;
+  std::vector<uint32_t> updated_cells_;
+  std::vector<uint32_t> cursors_;
+  std::vector<uint32_t> sorted_ids_;
+
+  size_t CellOf(const Vector &position) const;
+  Vector CellOrigin(size_t cell) const;
+  PackedBoid Encode(const Vector &position, const Vector &velocity,
+                    size_t cell) const;
+  Vector DecodePosition(const PackedBoid &boid, const Vector &origin) const;
+  Vector DecodeVelocity(const PackedBoid &boid) const;
+  void UpdateBoid(size_t index, size_t cell);
+  void SortUpdated();
+};
+
+extern template class CompactFlock<2>;
+extern template class CompactFlock<3>;
+
+} // namespace boid_sim
@@ -0,0 +1,126 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/boid.h"
+#include "core/flocking_params.h"
+#include "core/halo_transport.h"
+#include "core/tile_layout.h"
+
+namespace boid_sim {
+
+// Phase bookkeeping shared with worker processes, see decomposed_simulation.cc
+struct TileProcessControl;
+
+/**
+ * Runs the flock with the container split into tiles, one worker per tile.
+ * Workers are threads, or forked processes when the transport reaches other
+ * processes, and are started with the simulation and wait between the phases
+ * of a frame. Workers only see the boids they own plus "ghost" copies of the
+ * boids within vision range of their tile edges, and boids migrate to a new
+ * owner when they cross into its tile. Every frame produces the same boids as
+ * BoidContainer::AdvanceOnFrame would on the whole flock.
+ */
+class DecomposedSimulation {
+public:
+  /**
+   * Constructor for DecomposedSimulation. The transport must outlive the
+   * simulation. Throws if worker processes could not be started.
+   */
+  DecomposedSimulation(
+      const std::vector<std::vector<float>> &container_bounds,
+      const std::vector<Boid> &boids, size_t tiles_x, size_t tiles_y,
+      HaloTransport &transport,
+      const FlockingParams &params = FlockingParams());
+
+  /**
+   * Stops the tile workers and waits for them to exit
+   */
+  ~DecomposedSimulation();
+
+  DecomposedSimulation(const DecomposedSimulation &) = delete;
+  DecomposedSimulation &operator=(const DecomposedSimulation &) = delete;
+
+  /**
+   * Exchanges ghosts, updates every tile's boids, then migrates the boids
+   * that left their tile. Throws if a worker process failed or exited.
+   */
+  void AdvanceOnFrame(glm::vec2 &mouse_pos);
+
+  /**
+   * Gathers the boids of every tile, ordered by id. Worker processes are
+   * asked for their tiles first if they have stepped since the last time.
+   */
+  std::vector<Boid> boids() const;
+
+  const std::vector<Boid> &tile_boids(size_t tile) const;
+
+  const TileLayout &layout() const;
+
+  /**
+   * Whether the tiles are owned by worker processes rather than threads
+   */
+  bool uses_worker_processes() const;
+
+private:
+  // Steps of a frame, each run on every tile before the next one starts.
+  // Worker processes also report their tiles back when asked.
+  enum class TilePhase {
+    kSendGhosts,
+    kUpdate,
+    kSendMigrants,
+    kReceiveMigrants,
+    kReport
+  };
+
+  std::vector<std::vector<float>> container_bounds_;
+  FlockingParams params_;
+  TileLayout layout_;
+  HaloTransport &transport_;
+  float halo_width_;
+  std::vector<std::vector<Boid>> neighborhoods_;
+
+  // With worker processes this is only a copy of what they own, refreshed
+  // when it is next read after a frame
+  mutable std::vector<std::vector<Boid>> tiles_;
+  mutable bool tiles_stale_ = false;
+
+  // Tile worker threads, and the phase they are running. phase_ counts the
+  // phases handed out, and num_working_ the workers still busy with the
+  // current one.
+  std::vector<std::thread> workers_;
+  std::mutex phase_lock_;
+  std::condition_variable phase_started_;
+  std::condition_variable phase_finished_;
+  TilePhase phase_kind_ = TilePhase::kSendGhosts;
+  glm::vec2 phase_mouse_pos_;
+  size_t phase_ = 0;
+  size_t num_working_ = 0;
+  bool stopping_ = false;
+
+  // Tile worker processes, by pid, and the same phase bookkeeping in memory
+  // shared with them
+  std::vector<int> worker_pids_;
+  TileProcessControl *process_control_ = nullptr;
+
+  void StartWorkerProcesses();
+  void StopWorkerProcesses();
+  void RunOnEachTile(TilePhase phase, const glm::vec2 &mouse_pos);
+  void RunOnEachProcess(TilePhase phase, const glm::vec2 &mouse_pos) const;
+  void WorkerLoop(size_t tile);
+  void ProcessLoop(size_t tile, int parent);
+  void CollectTiles() const;
+  void RunTilePhase(TilePhase phase, size_t tile, glm::vec2 mouse_pos);
+  void SendGhosts(size_t tile);
+  void UpdateTile(size_t tile, glm::vec2 &mouse_pos);
+  void SendMigrants(size_t tile);
+  void ReceiveMigrants(size_t tile);
+};
+
+} // namespace boid_sim
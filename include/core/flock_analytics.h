@@ -0,0 +1,111 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "core/boid.h"
+#include "core/frame_budget_controller.h"
+#include "core/ring_buffer.h"
+
+namespace boid_sim {
+
+/**
+ * Measurements of the flock on a single frame.
+ */
+struct FrameAnalytics {
+  size_t frame = 0;
+  // Length of the average heading, 1 when every boid flies the same way
+  float polarization = 0.0f;
+  float mean_speed = 0.0f;
+  // Average number of other boids each boid can see
+  float mean_neighbors = 0.0f;
+  // Groups of 2 or more boids linked by boids that can see each other
+  size_t num_flocks = 0;
+  size_t largest_flock = 0;
+  // Boids per cell of a coarse grid over the container, row by row
+  size_t density_columns = 0;
+  size_t density_rows = 0;
+  std::vector<float> density;
+  // Time the previous frame took to step, and the fidelity this one was
+  // stepped at along with its level on the frame budget ladder
+  double step_ms = 0.0;
+  size_t quality_level = 0;
+  FidelitySettings fidelity;
+};
+
+/**
+ * Measures the flock while it is being stepped. The step reports which boids
+ * see each other as it finds them through its spatial grid, so flocks come
+ * out of a union-find over those pairs without a second neighbor search.
+ * Finished frames are pushed to a ring buffer for the app or a headless
+ * runner to drain.
+ */
+class FlockAnalytics {
+public:
+  /**
+   * Constructor for FlockAnalytics
+   */
+  FlockAnalytics(size_t density_columns, size_t density_rows,
+                 size_t buffer_capacity = 256);
+
+  /**
+   * Starts a new frame of num_boids boids, each in a flock of its own
+   */
+  void BeginFrame(size_t num_boids);
+
+  /**
+   * Records every boid that a boid can see. Safe to call from many threads at
+   * once.
+   */
+  void Link(size_t boid, const std::vector<size_t> &visible);
+
+  /**
+   * Records the step time and fidelity the frame budget worked with this
+   * frame
+   */
+  void SetFrameBudget(double step_ms, size_t quality_level,
+                      const FidelitySettings &fidelity);
+
+  /**
+   * Measures the frame's boids and pushes the results to the buffer
+   */
+  void EndFrame(size_t frame, BoidSpan boids,
+                const std::vector<size_t> &neighbor_counts,
+                const std::vector<std::vector<float>> &container_bounds,
+                size_t num_threads);
+
+  /**
+   * Finished frames, oldest first
+   */
+  RingBuffer<FrameAnalytics> &buffer();
+
+  /**
+   * The most recently finished frame
+   */
+  const FrameAnalytics &latest() const;
+
+private:
+  FrameAnalytics latest_;
+  RingBuffer<FrameAnalytics> buffer_;
+  std::unique_ptr<std::atomic<uint32_t>[]> parents_;
+  size_t parents_size_;
+  size_t num_boids_;
+  std::vector<size_t> flock_sizes_;
+  std::vector<glm::vec2> chunk_headings_;
+  std::vector<float> chunk_speeds_;
+  std::vector<size_t> chunk_neighbors_;
+
+  size_t FindRoot(size_t boid);
+  void CountFlocks();
+  void SumChunks(BoidSpan boids,
+                 const std::vector<size_t> &neighbor_counts,
+                 size_t num_threads);
+  void SplatDensity(BoidSpan boids,
+                    const std::vector<std::vector<float>> &container_bounds);
+};
+
+} // namespace boid_sim
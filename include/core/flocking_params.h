@@ -0,0 +1,26 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+namespace boid_sim {
+
+/**
+ * Weights applied to each of the three flocking rules when a boid steers,
+ * along with the speed, vision radius and view angle (in degrees) new boids
+ * are given. Prey flee from predators within flee_radius, and predators chase
+ * prey within hunt_radius.
+ */
+struct FlockingParams {
+  float align_percent = .30f;
+  float cohesion_percent = .95f;
+  float separation_percent = 1.0f;
+  float max_speed = 2.0f;
+  float fov_radius = 85.0f;
+  float view_angle = 360.0f;
+  float predator_max_speed = 2.5f;
+  float hunt_radius = 150.0f;
+  float flee_radius = 100.0f;
+};
+
+} // namespace boid_sim
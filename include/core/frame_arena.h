@@ -0,0 +1,115 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace boid_sim {
+
+/**
+ * Bump allocator for memory that only lives for one frame. Allocating moves
+ * a pointer forward and freeing does nothing; Reset hands the whole arena
+ * back at once. When a frame outgrows the arena, another block is added, and
+ * the next Reset merges the blocks into one big enough for the whole frame, so
+ * steady frames reuse a single block without touching the heap. Not thread
+ * safe, so every thread gets an arena of its own.
+ */
+class FrameArena {
+public:
+  /**
+   * Constructor for FrameArena. No memory is taken until the first
+   * allocation.
+   */
+  explicit FrameArena(size_t initial_capacity = 64 * 1024);
+
+  FrameArena(const FrameArena &) = delete;
+  FrameArena &operator=(const FrameArena &) = delete;
+
+  /**
+   * Returns bytes of memory aligned to alignment, valid until the next Reset
+   */
+  void *Allocate(size_t bytes, size_t alignment);
+
+  /**
+   * Frees everything allocated since the last Reset
+   */
+  void Reset();
+
+  /**
+   * Bytes allocated since the last Reset
+   */
+  size_t used_bytes() const;
+
+  /**
+   * Most bytes ever allocated between two Resets
+   */
+  size_t high_water_mark() const;
+
+  /**
+   * Bytes of memory held by the arena
+   */
+  size_t capacity() const;
+
+private:
+  struct Block {
+    std::unique_ptr<char[]> memory;
+    size_t size;
+  };
+
+  size_t initial_capacity_;
+  std::vector<Block> blocks_;
+  size_t current_block_ = 0;
+  size_t offset_ = 0;
+  size_t used_bytes_ = 0;
+  size_t high_water_mark_ = 0;
+  size_t capacity_ = 0;
+
+  void AddBlock(size_t min_size);
+};
+
+/**
+ * Standard library allocator that takes its memory from a FrameArena, for
+ * containers that only live for one frame
+ */
+template <typename T> class ArenaAllocator {
+public:
+  typedef T value_type;
+
+  explicit ArenaAllocator(FrameArena *arena) : arena_(arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &source) : arena_(source.arena()) {}
+
+  T *allocate(size_t count) {
+    return static_cast<T *>(arena_->Allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *, size_t) {}
+
+  FrameArena *arena() const { return arena_; }
+
+private:
+  FrameArena *arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &allocator1,
+                const ArenaAllocator<U> &allocator2) {
+  return allocator1.arena() == allocator2.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &allocator1,
+                const ArenaAllocator<U> &allocator2) {
+  return !(allocator1 == allocator2);
+}
+
+/**
+ * Vector whose memory comes from a FrameArena
+ */
+template <typename T> using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace boid_sim
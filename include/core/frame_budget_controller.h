@@ -0,0 +1,101 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace boid_sim {
+
+/**
+ * Knobs that trade how faithfully a frame is simulated for how long it takes.
+ * The defaults simulate every boid in full.
+ */
+struct FidelitySettings {
+  static const size_t kUnlimited;
+
+  // Most other boids a boid flocks with, keeping the nearest ones
+  size_t max_neighbors = kUnlimited;
+  // Steps each frame is split into, each moving boids a fraction of the way
+  size_t substeps = 1;
+  // Boids with more neighbors than this on the last frame only steer on every
+  // other frame, and coast in between
+  size_t lod_neighbor_threshold = kUnlimited;
+  // Boids with more neighbors than this on the last frame flock with every
+  // neighbor in the inner half of their vision, but only a sample of those
+  // further out
+  size_t far_field_neighbor_threshold = kUnlimited;
+};
+
+bool operator==(const FidelitySettings &settings1,
+                const FidelitySettings &settings2);
+
+bool operator!=(const FidelitySettings &settings1,
+                const FidelitySettings &settings2);
+
+/**
+ * Picks the fidelity of each frame from how long the last ones took to step,
+ * to hold a target frame time. Fidelity moves along a ladder of levels, from
+ * full quality at level 0 down to the cheapest settings. It drops a level
+ * once the smoothed step time has been over budget for a few frames, but only
+ * climbs back after a long stretch well under budget, and never moves again
+ * right after a change, so quality does not oscillate around the target.
+ */
+class FrameBudgetController {
+public:
+  /**
+   * Constructor for FrameBudgetController. At full quality frames are split
+   * into max_substeps steps.
+   */
+  explicit FrameBudgetController(double target_ms = 16.0,
+                                 size_t max_substeps = 1);
+
+  /**
+   * Records how long the last frame took to step and returns the fidelity to
+   * simulate the next one with
+   */
+  const FidelitySettings &Update(double step_ms);
+
+  /**
+   * Settings of a level of the ladder
+   */
+  FidelitySettings SettingsForLevel(size_t level) const;
+
+  const FidelitySettings &settings() const;
+
+  /**
+   * Current level of the ladder, 0 being full quality
+   */
+  size_t level() const;
+
+  size_t num_levels() const;
+
+  /**
+   * Moving average of the step times recorded so far
+   */
+  double smoothed_ms() const;
+
+  double target_ms() const;
+
+  /**
+   * Number of times the level has changed
+   */
+  size_t num_changes() const;
+
+private:
+  double target_ms_;
+  size_t max_substeps_;
+  size_t level_ = 0;
+  FidelitySettings settings_;
+  double smoothed_ms_ = 0.0;
+  size_t num_frames_ = 0;
+  size_t frames_over_ = 0;
+  size_t frames_under_ = 0;
+  size_t frames_since_change_ = 0;
+  size_t num_changes_ = 0;
+
+  void SetLevel(size_t level);
+};
+
+} // namespace boid_sim
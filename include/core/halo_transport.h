@@ -0,0 +1,136 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "core/boid.h"
+
+namespace boid_sim {
+
+/**
+ * Moves boids between the workers of a decomposed simulation. Each tile has a
+ * mailbox; senders queue boids into it and the owning worker drains it.
+ */
+class HaloTransport {
+public:
+  virtual ~HaloTransport() = default;
+
+  /**
+   * Prepares one mailbox per tile, dropping anything still undelivered. A
+   * mailbox never holds more than max_boids boids between two Receives.
+   */
+  virtual void Open(size_t num_tiles, size_t max_boids) = 0;
+
+  /**
+   * Queues boids for delivery to the destination tile
+   */
+  virtual void Send(size_t dest_tile, const std::vector<Boid> &boids) = 0;
+
+  /**
+   * Appends every boid delivered to the tile since the last call to boids
+   */
+  virtual void Receive(size_t dest_tile, std::vector<Boid> &boids) = 0;
+
+  /**
+   * Whether tiles can be owned by workers in other processes. Such
+   * transports must be opened before the workers are started.
+   */
+  virtual bool reaches_other_processes() const { return false; }
+};
+
+/**
+ * Transport for tile workers that are threads of one process. Boids are
+ * handed over directly through mutex guarded queues in ordinary memory, so
+ * this does not reach workers in other processes. It is kept as a simple
+ * stand-in for tests.
+ */
+class InProcessQueueTransport : public HaloTransport {
+public:
+  void Open(size_t num_tiles, size_t max_boids) override;
+
+  void Send(size_t dest_tile, const std::vector<Boid> &boids) override;
+
+  void Receive(size_t dest_tile, std::vector<Boid> &boids) override;
+
+private:
+  std::vector<std::vector<Boid>> mailboxes_;
+  std::vector<std::unique_ptr<std::mutex>> locks_;
+};
+
+/**
+ * Stand-in for a socket backend. Boids are flattened into the same byte
+ * stream of BoidRecords that would go over the wire, then looped back to the
+ * receiving tile.
+ */
+class LoopbackTransport : public HaloTransport {
+public:
+  void Open(size_t num_tiles, size_t max_boids) override;
+
+  void Send(size_t dest_tile, const std::vector<Boid> &boids) override;
+
+  void Receive(size_t dest_tile, std::vector<Boid> &boids) override;
+
+  /**
+   * Total number of bytes that have been sent since the transport was opened
+   */
+  size_t bytes_sent() const;
+
+private:
+  std::vector<std::vector<uint8_t>> streams_;
+  std::vector<std::unique_ptr<std::mutex>> locks_;
+  size_t bytes_sent_ = 0;
+  std::mutex bytes_lock_;
+};
+
+/**
+ * Transport for tile workers in separate processes. Every tile's mailbox is a
+ * queue of BoidRecords in one shared memory mapping, which worker processes
+ * forked after Open inherit. Senders claim room in a mailbox with an atomic
+ * counter, so they never wait on each other or on the receiver.
+ *
+ * A mailbox must not be sent to while it is being received from. Phases of a
+ * DecomposedSimulation never overlap, which guarantees that.
+ */
+class SharedMemoryTransport : public HaloTransport {
+public:
+  SharedMemoryTransport() = default;
+
+  /**
+   * Unmaps the mailboxes
+   */
+  ~SharedMemoryTransport() override;
+
+  SharedMemoryTransport(const SharedMemoryTransport &) = delete;
+  SharedMemoryTransport &operator=(const SharedMemoryTransport &) = delete;
+
+  /**
+   * Maps room for max_boids records per tile. Pages are only backed by memory
+   * once a record is written to them. Throws if the mapping fails.
+   */
+  void Open(size_t num_tiles, size_t max_boids) override;
+
+  /**
+   * Throws if the mailbox has no room left for the boids
+   */
+  void Send(size_t dest_tile, const std::vector<Boid> &boids) override;
+
+  void Receive(size_t dest_tile, std::vector<Boid> &boids) override;
+
+  bool reaches_other_processes() const override;
+
+private:
+  uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+  size_t num_tiles_ = 0;
+  size_t capacity_ = 0;
+  size_t mailbox_stride_ = 0;
+
+  void Close();
+};
+
+} // namespace boid_sim
@@ -0,0 +1,68 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "cinder/gl/gl.h"
+
+namespace boid_sim {
+
+/**
+ * Reads polygonal obstacles from a text file. Every line that is not blank or
+ * a # comment holds one polygon as a list of x y vertex coordinates. Throws if
+ * the file is missing or a line is not a polygon.
+ */
+std::vector<std::vector<glm::vec2>> ReadObstacles(const std::string &path);
+
+/**
+ * Signed distance to the nearest obstacle, baked once onto a grid so looking it
+ * up costs one bilinear sample however many obstacles there are. Distances are
+ * negative inside obstacles, and with solid walls, outside the container.
+ */
+class ObstacleField {
+public:
+  /**
+   * Constructor for ObstacleField. An empty field is far from everything.
+   */
+  ObstacleField();
+
+  /**
+   * Bakes the distance from every grid node to the closest obstacle edge and
+   * its gradient. Nodes are cell_size apart over the container.
+   */
+  void Bake(const std::vector<std::vector<glm::vec2>> &obstacles,
+            const std::vector<std::vector<float>> &container_bounds,
+            float cell_size, bool solid_walls);
+
+  /**
+   * Signed distance at position, interpolated between the four surrounding
+   * nodes. gradient is set to the direction distance grows fastest in, which
+   * points away from the nearest obstacle. Past the edge of the grid the
+   * distance keeps growing or shrinking with the edge's gradient.
+   */
+  float Sample(const glm::vec2 &position, glm::vec2 &gradient) const;
+
+  const std::vector<std::vector<glm::vec2>> &obstacles() const;
+
+  size_t columns() const;
+
+  size_t rows() const;
+
+  float cell_size() const;
+
+private:
+  std::vector<std::vector<glm::vec2>> obstacles_;
+  glm::vec2 origin_;
+  float cell_size_;
+  size_t columns_;
+  size_t rows_;
+  std::vector<float> distances_;
+  std::vector<glm::vec2> gradients_;
+
+  float ObstacleDistance(const glm::vec2 &point) const;
+};
+
+} // namespace boid_sim
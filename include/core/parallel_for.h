@@ -0,0 +1,27 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace boid_sim {
+
+/**
+ * Splits [begin, end) into one contiguous chunk per thread and runs work on
+ * every chunk, returning once all of them are done. The calling thread takes
+ * the first chunk itself, and the rest go to threads that are kept waiting
+ * between calls. Only one call uses those threads at a time, so a call made
+ * while they are busy, such as one from inside a chunk, runs every chunk on
+ * the calling thread instead.
+ */
+void ParallelFor(size_t begin, size_t end, size_t num_threads,
+                 const std::function<void(size_t, size_t)> &work);
+
+/**
+ * Number of threads to use when the caller did not ask for a specific count
+ */
+size_t DefaultThreadCount();
+
+} // namespace boid_sim
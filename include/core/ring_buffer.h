@@ -0,0 +1,81 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+namespace boid_sim {
+
+/**
+ * Fixed capacity queue for handing items from one producer thread to one
+ * consumer thread without locks. Slots are reused, so items that own memory
+ * (like vectors) stop allocating once every slot has held one.
+ */
+template <typename T> class RingBuffer {
+public:
+  /**
+   * Constructor for RingBuffer
+   */
+  explicit RingBuffer(size_t capacity)
+      : slots_(capacity > 0 ? capacity : 1), head_(0), tail_(0),
+        num_dropped_(0) {}
+
+  /**
+   * Copies an item into the buffer. If the consumer has fallen behind and the
+   * buffer is full, the item is dropped and false is returned.
+   */
+  bool Push(const T &item) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+
+    if (tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+      num_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    slots_[tail % slots_.size()] = item;
+    tail_.store(tail + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /**
+   * Copies the oldest item into item and removes it from the buffer. Returns
+   * false if there was nothing to take.
+   */
+  bool Pop(T &item) {
+    size_t head = head_.load(std::memory_order_relaxed);
+
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    item = slots_[head % slots_.size()];
+    head_.store(head + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  size_t size() const {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_acquire);
+  }
+
+  size_t capacity() const { return slots_.size(); }
+
+  /**
+   * Number of items that were dropped because the buffer was full
+   */
+  size_t num_dropped() const {
+    return num_dropped_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::vector<T> slots_;
+  std::atomic<size_t> head_;
+  std::atomic<size_t> tail_;
+  std::atomic<size_t> num_dropped_;
+};
+
+} // namespace boid_sim
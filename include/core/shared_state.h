@@ -0,0 +1,164 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/boid.h"
+#include "core/boid_record.h"
+
+namespace boid_sim {
+
+/**
+ * Block at the start of a shared state segment. It is followed by num_slots
+ * slots, slot_stride bytes apart, each a SharedSlotHeader followed by room
+ * for capacity BoidRecords.
+ */
+struct SharedStateHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t num_slots;
+  uint32_t capacity;
+  uint64_t slot_stride;
+
+  // Frames published so far. The newest is in slot
+  // (num_published - 1) % num_slots.
+  std::atomic<uint64_t> num_published;
+
+  // Set once the writer has gone away
+  std::atomic<uint32_t> closed;
+};
+
+/**
+ * Header of one slot in the ring. sequence is odd while the writer is filling
+ * the slot, and goes up by two for every frame written to it.
+ */
+struct SharedSlotHeader {
+  std::atomic<uint64_t> sequence;
+  uint64_t frame;
+  uint64_t num_boids;
+  float container_bounds[2][2];
+};
+
+/**
+ * One frame copied out of a shared state segment
+ */
+struct SharedFrame {
+  uint64_t frame = 0;
+  float container_bounds[2][2] = {{0, 0}, {0, 0}};
+  std::vector<BoidRecord> boids;
+};
+
+/**
+ * Publishes frames of a simulation into a named POSIX shared memory segment,
+ * so any number of processes on the same machine can follow it live.
+ *
+ * Frames go round a ring of slots. Each slot is guarded by a sequence lock:
+ * the writer never waits for readers, and a reader that copied a slot while
+ * it was being overwritten notices and copies again. With more than one slot
+ * that only happens when a reader is a whole lap of the ring behind.
+ *
+ * There can be one writer per name. Creating a writer replaces any segment
+ * left under its name, and the writer removes the name when it is destroyed.
+ * Readers that still have the old segment mapped see it as closed.
+ */
+class SharedStateWriter {
+public:
+  /**
+   * Creates the segment, with room for capacity boids in every one of the
+   * num_slots slots. name is a POSIX shared memory name like "/boid-sim".
+   * Throws if the segment could not be created.
+   */
+  SharedStateWriter(const std::string &name, size_t capacity,
+                    size_t num_slots = 4);
+
+  ~SharedStateWriter();
+
+  SharedStateWriter(const SharedStateWriter &) = delete;
+  SharedStateWriter &operator=(const SharedStateWriter &) = delete;
+
+  /**
+   * Writes a frame into the next slot and makes it the newest. Records are
+   * written straight into the segment, so publishing never allocates. Throws
+   * if there are more boids than the capacity.
+   */
+  void Publish(uint64_t frame,
+               const std::vector<std::vector<float>> &container_bounds,
+               const std::vector<Boid> &boids);
+
+  const std::string &name() const;
+
+  size_t capacity() const;
+
+  size_t num_slots() const;
+
+  /**
+   * Number of frames published so far
+   */
+  uint64_t num_published() const;
+
+private:
+  std::string name_;
+  uint8_t *data_;
+  size_t size_;
+  SharedStateHeader *header_;
+  uint64_t num_published_ = 0;
+};
+
+/**
+ * Maps a segment made by a SharedStateWriter, read only, and copies frames
+ * out of it without ever blocking the writer.
+ */
+class SharedStateReader {
+public:
+  /**
+   * Opens the segment called name. Throws if there is none, or if it was not
+   * made by a compatible writer.
+   */
+  explicit SharedStateReader(const std::string &name);
+
+  ~SharedStateReader();
+
+  SharedStateReader(const SharedStateReader &) = delete;
+  SharedStateReader &operator=(const SharedStateReader &) = delete;
+
+  /**
+   * Copies the newest frame into frame, retrying until it gets a copy that
+   * was not written to while it was taken. Returns false if nothing has been
+   * published yet. frame's vector keeps its space between calls.
+   */
+  bool ReadLatest(SharedFrame &frame);
+
+  /**
+   * Number of frames the writer has published. Cheap enough to poll, to only
+   * copy a frame once a new one has come in.
+   */
+  uint64_t num_published() const;
+
+  /**
+   * Whether the writer has gone away. A new writer under the same name makes
+   * a new segment, which needs a new reader.
+   */
+  bool writer_closed() const;
+
+  size_t capacity() const;
+
+  /**
+   * Number of copies thrown away because the writer overwrote the slot
+   * while it was being read
+   */
+  uint64_t num_retries() const;
+
+private:
+  uint8_t *data_;
+  size_t size_;
+  const SharedStateHeader *header_;
+  uint64_t num_retries_ = 0;
+};
+
+} // namespace boid_sim
@@ -0,0 +1,110 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "cinder/gl/gl.h"
+#include "core/vision_cone.h"
+
+namespace boid_sim {
+
+/**
+ * Grid of square cells that only stores the cells boids are in, found through
+ * an open addressed hash table keyed by cell coordinate. Unlike SpatialGrid it
+ * has no edges, so it works for unbounded worlds, and its memory grows with the
+ * number of occupied cells instead of the size of the world.
+ */
+class SparseGrid {
+public:
+  /**
+   * Constructor for SparseGrid
+   */
+  SparseGrid();
+
+  /**
+   * Buckets the positions into cells. Indices inside a cell stay in ascending
+   * order, and cells are numbered row by row like in SpatialGrid.
+   */
+  void Build(const std::vector<glm::vec2> &positions, float cell_size);
+
+  /**
+   * Fills indices with every position stored in the cells that overlap the
+   * square around center. Callers still need to check the exact distance.
+   */
+  void Gather(const glm::vec2 &center, float radius,
+              std::vector<size_t> &indices) const;
+
+  /**
+   * Same as Gather, but skips the cells that lie entirely outside of cone
+   */
+  void Gather(const glm::vec2 &center, float radius, const VisionCone &cone,
+              std::vector<size_t> &indices) const;
+
+  /**
+   * Number of the occupied cell holding position, or num_cells() if there is
+   * no such cell
+   */
+  size_t CellOf(const glm::vec2 &position) const;
+
+  /**
+   * Indices of the positions stored in a cell are
+   * entries()[cell_starts()[cell]] up to entries()[cell_starts()[cell + 1]]
+   */
+  const std::vector<size_t> &cell_starts() const;
+
+  const std::vector<size_t> &entries() const;
+
+  /**
+   * Number of occupied cells
+   */
+  size_t num_cells() const;
+
+  /**
+   * Number of slots in the hash table, kept at least twice num_cells()
+   */
+  size_t capacity() const;
+
+  float cell_size() const;
+
+  /**
+   * Bytes held by the table and cell lists, not counting entries()
+   */
+  size_t memory_bytes() const;
+
+private:
+  struct Slot {
+    int32_t column;
+    int32_t row;
+    uint32_t cell;
+  };
+
+  static const uint32_t kEmptySlot = UINT32_MAX;
+
+  float cell_size_;
+  std::vector<Slot> table_;
+  size_t mask_;
+  size_t shift_;
+  std::vector<int32_t> cell_columns_;
+  std::vector<int32_t> cell_rows_;
+  std::vector<size_t> cell_of_;
+  std::vector<size_t> cell_starts_;
+  std::vector<size_t> entries_;
+  // Kept between builds so a steady-state build does not allocate
+  std::vector<size_t> cursors_;
+  std::vector<size_t> cell_order_;
+  std::vector<size_t> cell_renumber_;
+  std::vector<int32_t> sorted_columns_;
+  std::vector<int32_t> sorted_rows_;
+
+  int32_t CoordinateOf(float coordinate) const;
+  size_t SlotOf(int32_t column, int32_t row) const;
+  uint32_t Find(int32_t column, int32_t row) const;
+  uint32_t Insert(int32_t column, int32_t row);
+  void SortCells();
+  void Rehash(size_t capacity);
+};
+
+} // namespace boid_sim
@@ -0,0 +1,52 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <vector>
+
+#include "cinder/gl/gl.h"
+#include "core/basic_spatial_grid.h"
+#include "core/vision_cone.h"
+
+namespace boid_sim {
+
+/**
+ * Uniform grid of square cells over the container, rebuilt from the boid
+ * positions every frame. With cells at least as big as a boid's vision radius,
+ * every boid it can see is in its own cell or one of the 8 around it.
+ * Building and the plain box query come from BasicSpatialGrid<2>; this adds
+ * the queries that only make sense in 2D. Cells always keep the size they
+ * are built with, since BoidContainer switches to a SparseGrid before a
+ * dense grid would need too many of them.
+ */
+class SpatialGrid : public BasicSpatialGrid<2> {
+public:
+  /**
+   * Constructor for SpatialGrid
+   */
+  SpatialGrid();
+
+  using BasicSpatialGrid<2>::Gather;
+
+  /**
+   * Same as Gather, but skips the cells that lie entirely outside of cone.
+   * Edge cells also hold positions outside the container, so they are always
+   * kept.
+   */
+  void Gather(const glm::vec2 &center, float radius, const VisionCone &cone,
+              std::vector<size_t> &indices) const;
+
+  /**
+   * Finds the inclusive column and row range of the cells overlapping the
+   * square around center
+   */
+  void CellRange(const glm::vec2 &center, float radius, size_t &min_column,
+                 size_t &max_column, size_t &min_row, size_t &max_row) const;
+
+  size_t columns() const;
+
+  size_t rows() const;
+};
+
+} // namespace boid_sim
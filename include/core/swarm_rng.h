@@ -0,0 +1,53 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <cstdint>
+
+namespace boid_sim {
+
+/**
+ * Counter based random number generator. Every number is a pure function of
+ * the seed, a counter and a draw slot, so any thread can produce the numbers
+ * for any boid without sharing state, and a seed always gives the same swarm.
+ */
+class SwarmRng {
+public:
+  /**
+   * Constructor for SwarmRng
+   */
+  explicit SwarmRng(uint64_t seed = 0, uint64_t counter = 0);
+
+  /**
+   * Hands out count consecutive counters and returns the first of them
+   */
+  uint64_t Reserve(uint64_t count);
+
+  /**
+   * Returns 64 random bits for the given counter and draw slot
+   */
+  uint64_t Bits(uint64_t counter, uint32_t slot) const;
+
+  /**
+   * Returns a random float in [0, 1) for the given counter and draw slot
+   */
+  float Uniform(uint64_t counter, uint32_t slot) const;
+
+  /**
+   * Returns a random float in [min, max) for the given counter and draw slot
+   */
+  float Uniform(uint64_t counter, uint32_t slot, float min, float max) const;
+
+  uint64_t seed() const;
+
+  uint64_t counter() const;
+
+private:
+  uint64_t seed_;
+  uint64_t counter_;
+
+  static uint64_t SplitMix64(uint64_t value);
+};
+
+} // namespace boid_sim
@@ -0,0 +1,53 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <vector>
+
+#include "core/boid.h"
+#include "core/swarm_rng.h"
+
+namespace boid_sim {
+
+/**
+ * Shapes that a freshly spawned swarm can start out in.
+ */
+enum class SpawnDistribution {
+  // Spread evenly over the whole container
+  kUniform,
+  // Gathered into a few gaussian blobs at random spots in the container
+  kClustered,
+  // Circling the center of the container in a band
+  kRing
+};
+
+/**
+ * Describes how a swarm should be spawned.
+ */
+struct SpawnOptions {
+  uint64_t seed = 0;
+  SpawnDistribution distribution = SpawnDistribution::kUniform;
+  size_t num_clusters = 4;
+  // Standard deviation of a cluster, as a fraction of the container's
+  // shorter side
+  float cluster_spread = .05f;
+  // Radius and thickness of the ring, as fractions of the container's shorter
+  // side
+  float ring_radius = .35f;
+  float ring_width = .05f;
+  // 0 picks a thread count based on the machine
+  size_t num_threads = 0;
+};
+
+/**
+ * Appends num_boids new boids to boids, numbering them after the boids
+ * already there. Positions and directions are filled in parallel, but each
+ * boid's values only depend on the rng seed and its counter, so the swarm is
+ * the same for any thread count.
+ */
+void SpawnSwarm(const std::vector<std::vector<float>> &container_bounds,
+                size_t num_boids, const SpawnOptions &options, float max_speed,
+                float fov_radius, SwarmRng &rng, std::vector<Boid> &boids);
+
+} // namespace boid_sim
@@ -0,0 +1,61 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <vector>
+
+#include "cinder/gl/gl.h"
+
+namespace boid_sim {
+
+/**
+ * Splits the container bounds into an even grid of rectangular tiles. The
+ * outer tiles stretch out to infinity so that every position, including one
+ * that has drifted out of bounds, belongs to exactly one tile.
+ */
+class TileLayout {
+public:
+  /**
+   * Constructor for TileLayout
+   */
+  TileLayout(const std::vector<std::vector<float>> &container_bounds,
+             size_t tiles_x, size_t tiles_y);
+
+  /**
+   * Returns the index of the tile that owns the given position
+   */
+  size_t TileOf(const glm::vec2 &position) const;
+
+  /**
+   * Returns the distance from the position to the closest point of the tile,
+   * 0 if the position is inside of it
+   */
+  float DistanceToTile(const glm::vec2 &position, size_t tile) const;
+
+  /**
+   * Fills tiles with every tile, other than the one that owns the position,
+   * that lies within radius of the position.
+   */
+  void TilesWithin(const glm::vec2 &position, float radius,
+                   std::vector<size_t> &tiles) const;
+
+  size_t num_tiles() const;
+
+  size_t tiles_x() const;
+
+  size_t tiles_y() const;
+
+private:
+  glm::vec2 origin_;
+  glm::vec2 tile_size_;
+  size_t tiles_x_;
+  size_t tiles_y_;
+
+  size_t ColumnOf(float x) const;
+  size_t RowOf(float y) const;
+  float AxisDistance(float value, size_t index, size_t count, float origin,
+                     float size) const;
+};
+
+} // namespace boid_sim
@@ -0,0 +1,50 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include "cinder/gl/gl.h"
+
+namespace boid_sim {
+
+/**
+ * The part of the plane a boid can see: a cone of view_angle degrees centered
+ * on its heading, with a blind spot behind it. A cone of 360 degrees sees all
+ * the way around.
+ */
+class VisionCone {
+public:
+  /**
+   * Constructor for VisionCone. A zero heading sees all the way around.
+   */
+  VisionCone(const glm::vec2 &apex, const glm::vec2 &heading,
+             float view_angle);
+
+  /**
+   * Whether point lies inside the cone. Only compares the squared dot product
+   * against the squared cosine of the half angle, so it takes no square root.
+   */
+  bool Contains(const glm::vec2 &point) const;
+
+  /**
+   * Whether any part of the square cell with the given corner and side length
+   * might be inside the cone. A false answer is certain, so the boids in that
+   * cell can be skipped without looking at them.
+   */
+  bool MayOverlapCell(const glm::vec2 &min_corner, float size) const;
+
+  bool is_full() const;
+
+private:
+  glm::vec2 apex_;
+  glm::vec2 heading_;
+  float view_cos_;
+  float view_cos_squared_;
+  bool full_;
+
+  // Edges of the cone if it is at most a half plane, else of the blind spot
+  glm::vec2 left_edge_;
+  glm::vec2 right_edge_;
+};
+
+} // namespace boid_sim
@@ -0,0 +1,100 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boid_sim {
+
+/**
+ * Runs a batch of tasks of uneven cost over a fixed number of workers. Tasks
+ * are dealt out up front, most expensive first, to whichever worker has the
+ * least estimated work. Each worker then drains its own deque from the front
+ * and, once it runs dry, steals from the back of the other workers' deques,
+ * so a bad estimate never leaves cores idle while one worker is still busy.
+ * Worker threads live as long as the scheduler and wait between runs, with
+ * the calling thread acting as worker 0.
+ */
+class WorkStealingScheduler {
+public:
+  /**
+   * Constructor for WorkStealingScheduler
+   */
+  explicit WorkStealingScheduler(size_t num_workers = 1);
+
+  /**
+   * Copy constructor, starting workers of its own
+   */
+  WorkStealingScheduler(const WorkStealingScheduler &source);
+
+  /**
+   * Copy assignment operator, keeping this scheduler's workers if the count
+   * is the same
+   */
+  WorkStealingScheduler &operator=(const WorkStealingScheduler &source);
+
+  /**
+   * Stops and joins the workers
+   */
+  ~WorkStealingScheduler();
+
+  /**
+   * Runs work(task, worker) once for every task, where task is an index into
+   * task_costs. Returns once every task is done.
+   */
+  void Run(const std::vector<size_t> &task_costs,
+           const std::function<void(size_t, size_t)> &work);
+
+  /**
+   * Stops the workers and starts num_workers - 1 new ones, unless there are
+   * that many already
+   */
+  void set_num_workers(size_t num_workers);
+
+  size_t num_workers() const;
+
+  /**
+   * Number of tasks taken from another worker's deque during the last Run
+   */
+  size_t num_steals() const;
+
+private:
+  struct WorkerDeque {
+    std::mutex lock;
+    std::deque<size_t> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerDeque>> deques_;
+  std::vector<size_t> order_;
+  std::vector<size_t> worker_costs_;
+  std::atomic<size_t> num_steals_;
+
+  // Worker threads, and the run they are on. run_ counts the runs handed
+  // out, and num_running_ the threads still busy with the current one.
+  std::vector<std::thread> threads_;
+  std::mutex run_lock_;
+  std::condition_variable run_started_;
+  std::condition_variable run_finished_;
+  const std::function<void(size_t, size_t)> *run_work_ = nullptr;
+  size_t run_ = 0;
+  size_t num_running_ = 0;
+  bool stopping_ = false;
+
+  void StopThreads();
+  void ThreadLoop(size_t worker, size_t last_run);
+  void Deal(const std::vector<size_t> &task_costs);
+  void WorkerLoop(size_t worker,
+                  const std::function<void(size_t, size_t)> &work);
+  bool PopOwn(size_t worker, size_t &task);
+  bool Steal(size_t worker, size_t &task);
+};
+
+} // namespace boid_sim
@@ -0,0 +1,128 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "core/flocking_params.h"
+#include "core/swarm_spawner.h"
+
+namespace boid_sim {
+
+namespace visualizer {
+class BoidContainer;
+} // namespace visualizer
+
+namespace headless {
+
+/**
+ * Values to sweep over. Every combination of one value from each list
+ * becomes a run.
+ */
+struct EnsembleGrid {
+  std::vector<float> align_percents{.30f};
+  std::vector<float> cohesion_percents{.95f};
+  std::vector<float> separation_percents{1.0f};
+  std::vector<float> fov_radii{85.0f};
+  std::vector<float> max_speeds{2.0f};
+  std::vector<size_t> boid_counts{175};
+};
+
+/**
+ * Settings shared by every run of an ensemble.
+ */
+struct EnsembleSettings {
+  size_t container_width = 1500;
+  size_t container_height = 900;
+  size_t num_frames = 600;
+  // Each combination is repeated with this many different seeds
+  size_t num_replicas = 1;
+  SpawnOptions spawn_options;
+  // 0 uses every core
+  size_t num_threads = 0;
+};
+
+/**
+ * One independent simulation of the ensemble.
+ */
+struct EnsembleRun {
+  size_t index;
+  size_t replica;
+  uint64_t seed;
+  size_t num_boids;
+  FlockingParams flocking_params;
+  // Index of the starting swarm, shared by the runs that only differ in
+  // their rule weights
+  size_t swarm;
+};
+
+/**
+ * Metrics measured on the last frame of a run, see FrameAnalytics.
+ */
+struct RunSummary {
+  EnsembleRun run;
+  // Length of the average heading, 1 when every boid flies the same way
+  float polarization;
+  float mean_speed;
+  // Average number of other boids each boid can see
+  float mean_neighbors;
+  size_t num_flocks;
+  size_t largest_flock;
+  // Fraction of the boids that ended up outside of the container
+  float out_of_bounds_fraction;
+  double ms_per_frame;
+};
+
+/**
+ * Runs every combination of an EnsembleGrid as its own headless simulation.
+ * Runs with the same seed, boid count, max speed and vision radius start
+ * from the same swarm, which is spawned once and kept read only. Runs are
+ * handed out to worker threads one at a time, and each worker steps its own
+ * copy of the starting swarm of its run. A starting swarm is only spawned
+ * when its first run starts and is freed after its last one, so memory grows
+ * with the number of threads rather than the size of the ensemble.
+ */
+class EnsembleRunner {
+public:
+  /**
+   * Constructor for EnsembleRunner
+   */
+  EnsembleRunner(const EnsembleGrid &grid, const EnsembleSettings &settings);
+
+  /**
+   * Runs the whole ensemble and returns a summary per run, in run order
+   */
+  std::vector<RunSummary> Run() const;
+
+  /**
+   * Writes the summaries as CSV, one row per run
+   */
+  static void WriteCsv(std::ostream &out,
+                       const std::vector<RunSummary> &summaries);
+
+  const std::vector<EnsembleRun> &runs() const;
+
+  /**
+   * Most starting swarms the last call to Run held at once
+   */
+  size_t peak_live_swarms() const;
+
+private:
+  EnsembleSettings settings_;
+  std::vector<EnsembleRun> runs_;
+  // First run of every starting swarm
+  std::vector<size_t> swarm_runs_;
+  mutable size_t peak_live_swarms_ = 0;
+
+  std::unique_ptr<visualizer::BoidContainer>
+  BuildSwarm(const EnsembleRun &run) const;
+  RunSummary RunOne(const EnsembleRun &run,
+                    const visualizer::BoidContainer &swarm) const;
+};
+
+} // namespace headless
+
+} // namespace boid_sim
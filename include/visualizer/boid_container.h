@@ -3,29 +3,98 @@
 //
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "cinder/Channel.h"
+#include "cinder/gl/Texture.h"
 #include "core/boid.h"
+#include "core/flock_analytics.h"
+#include "core/flocking_params.h"
+#include "core/frame_arena.h"
+#include "core/frame_budget_controller.h"
+#include "core/obstacle_field.h"
+#include "core/shared_state.h"
+#include "core/sparse_grid.h"
+#include "core/spatial_grid.h"
+#include "core/swarm_rng.h"
+#include "core/swarm_spawner.h"
+#include "core/work_stealing_scheduler.h"
+#include "visualizer/camera_2d.h"
 
 namespace boid_sim {
 
 namespace visualizer {
 
+/**
+ * The part of the swarm a camera sees, and how to draw it
+ */
+struct RenderBatch {
+  RenderDetail detail = RenderDetail::kTriangles;
+
+  // Boids to draw as triangles or points, in ascending order
+  std::vector<size_t> boids;
+
+  // For a density texture, how many boids are in each texel, row by row. The
+  // texture covers density_columns by density_rows square texels of
+  // density_cell_size, starting at density_origin in the world.
+  std::vector<uint32_t> density;
+  size_t density_columns = 0;
+  size_t density_rows = 0;
+  glm::vec2 density_origin = glm::vec2(0, 0);
+  float density_cell_size = 0.0f;
+};
+
 class BoidContainer {
 public:
+  /**
+   * Buffers batched nearest boid queries work in. Keeping one around between
+   * batches lets them answer without allocating once it has grown.
+   */
+  struct QueryScratch {
+    struct Candidate {
+      glm::vec2 position;
+      size_t index;
+    };
+
+    // Cell key and index of every query, sorted so each bucket is a run
+    std::vector<std::pair<uint64_t, size_t>> buckets;
+    std::vector<size_t> gathered;
+    // Candidates of the current bucket, sorted by y
+    std::vector<Candidate> candidates;
+  };
+
   /**
    * Default Constructor for BoidContainer
    */
   BoidContainer();
 
   /**
-   * Constructor for BoidContainer
+   * Constructor for BoidContainer. Boids are spread uniformly from a seed
+   * drawn from the system's entropy source.
    */
   BoidContainer(size_t display_window_width, size_t display_window_height,
                 size_t num_boids);
 
   /**
-   * Copy assignment operator
+   * Constructor for BoidContainer. The same spawn options always produce the
+   * same swarm.
+   */
+  BoidContainer(size_t display_window_width, size_t display_window_height,
+                size_t num_boids, const SpawnOptions &spawn_options,
+                const FlockingParams &flocking_params = FlockingParams());
+
+  /**
+   * Copy constructor
+   */
+  BoidContainer(const BoidContainer &source);
+
+  /**
+   * Copy assignment operator. Analytics and the frame budget controller are
+   * not carried over to the copy, but the fidelity is.
    */
   BoidContainer &operator=(const BoidContainer &source);
 
@@ -34,12 +103,210 @@ public:
    */
   void Display();
 
+  /**
+   * Displays the boids the camera can see, in world coordinates, at the
+   * detail the camera picks for the current zoom. Only boids in the cells of
+   * the spatial index that overlap the view are drawn, so the cost follows
+   * what is on screen rather than the size of the swarm.
+   */
+  void Display(const Camera2D &camera);
+
+  /**
+   * Fills batch with what Display(camera) would draw. Zoomed in, these are
+   * the boids in or just around the view, found through the spatial index of
+   * the last frame. Zoomed out to a density texture, the texels add up the
+   * boid counts of the index cells they cover, so boids are never looked at
+   * one by one (only when the swarm is in a sparse index).
+   */
+  void CullForCamera(const Camera2D &camera, RenderBatch &batch) const;
+
+  /**
+   * What the last Display(camera) drew
+   */
+  const RenderBatch &render_batch() const;
+
   /**
    * Updates the positions and velocities of all boids based on the three rules
    * of cohesion, separation, and alignment
    */
   void AdvanceOnFrame(glm::vec2 &mouse_pos);
 
+  /**
+   * Sets how many threads share the work of each frame. The frame is cut into
+   * tasks of neighboring boids with roughly equal cost, estimated from how
+   * many neighbors each boid had on the previous frame, and the tasks are
+   * balanced over the threads by work stealing.
+   */
+  void set_num_threads(size_t num_threads);
+
+  size_t num_threads() const;
+
+  /**
+   * In deterministic mode every boid sums up its neighbors in id order, so a
+   * frame gives bit for bit the same result for any thread count. It is on by
+   * default; turning it off skips sorting each boid's neighbors.
+   */
+  void set_deterministic(bool deterministic);
+
+  bool is_deterministic() const;
+
+  /**
+   * In an unbounded world boids are never steered back into the container and
+   * roam freely, so neighbors are found with a SparseGrid. The container
+   * bounds then only mark the area boids spawn in and analytics cover.
+   */
+  void set_unbounded(bool unbounded);
+
+  bool is_unbounded() const;
+
+  /**
+   * Whether the last frame found neighbors with a SparseGrid, which is used for
+   * unbounded worlds and for worlds too big for a dense grid to be worth it
+   */
+  bool uses_sparse_grid() const;
+
+  /**
+   * Adds num_predators predators spread uniformly over the container. They
+   * chase the nearest prey within the hunting radius while the prey flee from
+   * any predator within the flee radius. Each role is kept in its own spatial
+   * index, so a prey's flee query only searches the few predators and a
+   * predator's hunt only the prey cells within its reach.
+   */
+  void AddPredators(size_t num_predators);
+
+  /**
+   * Number of predators, which always come after all of the prey in boids()
+   */
+  size_t num_predators() const;
+
+  /**
+   * Loads polygonal obstacles from a file (see ReadObstacles) and bakes them
+   * into a distance field with cell_size spaced nodes over the container.
+   * Boids then steer clear of the obstacles, and unless the world is
+   * unbounded when they are loaded, of the container walls through the same
+   * field.
+   */
+  void LoadObstacles(const std::string &path, float cell_size = 8.0f);
+
+  /**
+   * Same as LoadObstacles, for obstacles that are already in memory
+   */
+  void SetObstacles(const std::vector<std::vector<glm::vec2>> &obstacles,
+                    float cell_size = 8.0f);
+
+  void ClearObstacles();
+
+  /**
+   * The baked obstacles, or nullptr if none are loaded
+   */
+  const ObstacleField *obstacle_field() const;
+
+  /**
+   * Sets how faithfully frames are simulated. Any setting other than the
+   * defaults trades accuracy for speed; see FidelitySettings.
+   */
+  void set_fidelity(const FidelitySettings &fidelity);
+
+  const FidelitySettings &fidelity() const;
+
+  /**
+   * Hands the fidelity over to a FrameBudgetController, which adjusts it
+   * after every frame to hold target_ms per frame. At full quality frames are
+   * split into max_substeps substeps.
+   */
+  void EnableFrameBudget(double target_ms, size_t max_substeps = 1);
+
+  /**
+   * Stops adapting the fidelity and goes back to full quality
+   */
+  void DisableFrameBudget();
+
+  /**
+   * The controller picking the fidelity, or nullptr if there is none
+   */
+  const FrameBudgetController *frame_budget() const;
+
+  /**
+   * Time in milliseconds the last frame took to step
+   */
+  double last_step_ms() const;
+
+  /**
+   * Most bytes of scratch memory a step has taken from the frame arena
+   */
+  size_t scratch_high_water_mark() const;
+
+  /**
+   * Starts measuring polarization, flocks and density on every frame. Density
+   * is counted on a density_columns by density_rows grid over the container.
+   */
+  void EnableAnalytics(size_t density_columns, size_t density_rows,
+                       size_t buffer_capacity = 256);
+
+  void DisableAnalytics();
+
+  /**
+   * Analytics of the frames stepped so far, or nullptr if they are disabled
+   */
+  FlockAnalytics *analytics();
+
+  /**
+   * Publishes every frame from now on into the POSIX shared memory segment
+   * called name, for SharedStateReaders in other processes to follow. If the
+   * swarm outgrows the segment, it is made again under the same name.
+   */
+  void EnableStateExport(const std::string &name, size_t num_slots = 4);
+
+  void DisableStateExport();
+
+  /**
+   * The writer frames are published with, or nullptr if there is none
+   */
+  const SharedStateWriter *state_writer() const;
+
+  /**
+   * Number of frames stepped since the container was created
+   */
+  size_t frame_count() const;
+
+  /**
+   * Number of other boids each boid could see on the last frame
+   */
+  const std::vector<size_t> &neighbor_counts() const;
+
+  /**
+   * Fills indices, in ascending order, with every boid within radius of
+   * center. Queries reuse the space already in the caller's vectors, so once
+   * those have grown they answer without allocating. Between frames the
+   * queries look boids up in the spatial index of the last frame.
+   */
+  void QueryRadius(const glm::vec2 &center, float radius,
+                   std::vector<size_t> &indices) const;
+
+  /**
+   * Fills indices, in ascending order, with every boid inside the rectangle
+   * between min_corner and max_corner, edges included
+   */
+  void QueryRect(const glm::vec2 &min_corner, const glm::vec2 &max_corner,
+                 std::vector<size_t> &indices) const;
+
+  /**
+   * Index of the boid closest to point, the lowest index on ties, or
+   * boids().size() if there are no boids. Uses scratch for candidates.
+   */
+  size_t QueryNearest(const glm::vec2 &point,
+                      std::vector<size_t> &scratch) const;
+
+  /**
+   * Answers one nearest boid query per point into nearest. When many points
+   * fall in the same cell of the spatial index, they share one gather of
+   * candidates sorted by y, and each only walks the rows around it. Points
+   * with no candidate close enough, or too few to share, search on their own.
+   */
+  void QueryNearest(const std::vector<glm::vec2> &points,
+                    std::vector<size_t> &nearest,
+                    QueryScratch &scratch) const;
+
   /**
    * Sets all of the boids to "Seek Mouse" mode.
    */
@@ -50,23 +317,128 @@ public:
    */
   void DefaultBehavior();
 
+  /**
+   * Saves the bounds, flocking parameters, fidelity, frame count and every
+   * boid with its last neighbor count to a checkpoint file
+   */
+  void SaveCheckpoint(const std::string &path) const;
+
+  /**
+   * Replaces the current simulation state with the one stored in a checkpoint
+   * file, picking the run back up exactly where it was saved.
+   */
+  void RestoreCheckpoint(const std::string &path);
+
   const std::vector<boid_sim::Boid> &boids() const;
 
+  /**
+   * Replaces the boids. Predators are moved after all of the prey, keeping the
+   * order within each role.
+   */
   void set_boids(const std::vector<boid_sim::Boid> &boids);
 
+  const std::vector<std::vector<float>> &container_bounds() const;
+
+  const FlockingParams &flocking_params() const;
+
+  /**
+   * Changes the rules from the next frame on. Boids that are already spawned
+   * keep their max speed and vision radius.
+   */
+  void set_flocking_params(const FlockingParams &flocking_params);
+
+  const SwarmRng &rng() const;
+
 private:
   std::vector<std::vector<float>> container_bounds_;
   size_t num_boids_;
+  FlockingParams flocking_params_;
+  SwarmRng rng_;
   std::vector<boid_sim::Boid> boids_;
+  size_t num_threads_ = 1;
+  bool deterministic_ = true;
+  bool unbounded_ = false;
+  bool use_sparse_grid_ = false;
+  bool index_valid_ = false;
+  float max_displacement_ = 0.0f;
+  size_t num_predators_ = 0;
+  SpatialGrid grid_;
+  SparseGrid sparse_grid_;
+  SpatialGrid predator_grid_;
+  SparseGrid predator_sparse_grid_;
+  std::vector<glm::vec2> positions_;
+  std::vector<glm::vec2> predator_positions_;
+  std::vector<size_t> neighbor_counts_;
+  size_t frame_count_ = 0;
+  std::unique_ptr<FlockAnalytics> analytics_;
+  std::unique_ptr<SharedStateWriter> state_writer_;
+  FidelitySettings fidelity_;
+  std::unique_ptr<FrameBudgetController> frame_budget_;
+  double last_step_ms_ = 0.0;
+  std::shared_ptr<const ObstacleField> obstacle_field_;
+  WorkStealingScheduler scheduler_;
+  std::vector<size_t> task_starts_;
+  std::vector<size_t> task_costs_;
+  FrameArena arena_;
+  std::vector<std::vector<size_t>> candidate_scratch_;
+  RenderBatch render_batch_;
+  ci::Channel8u density_channel_;
+  ci::gl::Texture2dRef density_texture_;
 
   void SetContainerBounds(size_t display_window_width,
                           size_t display_window_height);
 
-  void PopulateBoids();
+  void PopulateBoids(const SpawnOptions &spawn_options);
+
+  void PartitionRoles();
+
+  void DrawObstacles();
+
+  void DrawDensity();
+
+  void CountDensity(const glm::vec2 &min_corner, const glm::vec2 &max_corner,
+                    float texel_size, RenderBatch &batch) const;
+
+  void Substep(glm::vec2 &mouse_pos, float time_step, bool measure);
+
+  void PublishState();
+
+  void PlanTasks();
+
+  size_t BoidAtEntry(size_t entry) const;
+
+  const glm::vec2 &PositionAt(size_t index) const;
+
+  void GatherRole(bool predators, const glm::vec2 &center, float radius,
+                  const VisionCone *cone, std::vector<size_t> &indices) const;
+
+  glm::vec2 SteerAcrossRoles(size_t index, std::vector<size_t> &candidates);
+
+  bool IsCrowded(const std::vector<glm::vec2> &points) const;
+
+  void BucketQueries(const std::vector<glm::vec2> &points,
+                     QueryScratch &scratch) const;
+
+  size_t BucketEnd(const std::vector<glm::vec2> &points,
+                   const QueryScratch &scratch, size_t begin,
+                   glm::vec2 &center, float &reach) const;
+
+  void SortCandidates(QueryScratch &scratch) const;
+
+  size_t
+  NearestCandidate(const std::vector<QueryScratch::Candidate> &candidates,
+                   const glm::vec2 &point, float &nearest_distance) const;
+
+  bool IsIndexed() const;
+
+  void GatherIndexed(const glm::vec2 &center, float radius,
+                     std::vector<size_t> &indices) const;
 
-  static glm::vec2 GenerateRandomDirection();
+  void UpdateBoid(size_t index, const ArenaVector<Boid> &boid_snapshot,
+                  glm::vec2 &mouse_pos, float time_step,
+                  FlockAnalytics *analytics, std::vector<size_t> &candidates);
 
-  glm::vec2 GenerateRandomPosition();
+  void CapNeighbors(size_t index, std::vector<size_t> &candidates) const;
 };
 
 } // namespace visualizer
@@ -3,7 +3,10 @@
 //
 #pragma once
 
+#include <string>
+
 #include "boid_container.h"
+#include "camera_2d.h"
 #include "cinder/app/App.h"
 #include "cinder/app/MouseEvent.h"
 #include "cinder/app/RendererGl.h"
@@ -32,7 +35,8 @@ public:
 
   /**
    * Updates the mouse position based on current mouse location on screen. N
-   * updates occur if mouse is not dragged.
+   * updates occur if mouse is not dragged. Dragging with the right button
+   * pans the camera.
    */
   void mouseDrag(ci::app::MouseEvent event) override;
 
@@ -43,7 +47,13 @@ public:
   void mouseMove(ci::app::MouseEvent event) override;
 
   /**
-   * Puts boids in "Track Mouse" mode on left click hold.
+   * Zooms the camera in or out around the cursor.
+   */
+  void mouseWheel(ci::app::MouseEvent event) override;
+
+  /**
+   * Puts boids in "Track Mouse" mode on left click hold, and starts panning
+   * on right click.
    */
   void mouseDown(ci::app::MouseEvent event) override;
 
@@ -52,13 +62,40 @@ public:
    */
   void mouseUp(ci::app::MouseEvent event) override;
 
+  /**
+   * Adds a predator to the swarm when "p" is pressed, puts the camera back
+   * over the whole container when "r" is pressed, and starts or stops
+   * publishing frames to shared memory when "e" is pressed.
+   */
+  void keyDown(ci::app::KeyEvent event) override;
+
+  /**
+   * Keeps the camera's viewport the size of the window.
+   */
+  void resize() override;
+
 private:
   const size_t kWindowWidth = 1500;
   const size_t kWindowHeight = 900;
   const size_t kNumBoids = 175;
+  const size_t kDensityColumns = 15;
+  const size_t kDensityRows = 9;
+  const double kTargetFrameMs = 16.0;
+  const size_t kMaxSubsteps = 2;
+  // How much one notch of the mouse wheel zooms in
+  const float kZoomStep = 1.15f;
+  // Shared memory name frames are published under, see boid-state-reader
+  const std::string kStateExportName = "/boid-sim";
 
   BoidContainer boid_container_;
+  Camera2D camera_;
   glm::vec2 kMousePos;
+  glm::vec2 pan_start_;
+  FrameAnalytics frame_analytics_;
+
+  void DrawAnalytics() const;
+
+  void ResetCamera();
 };
 
 } // namespace visualizer
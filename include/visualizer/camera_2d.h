@@ -0,0 +1,91 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#pragma once
+
+#include "cinder/gl/gl.h"
+
+namespace boid_sim {
+
+namespace visualizer {
+
+/**
+ * How boids are drawn. Triangles show each boid's heading, points only where
+ * it is, and a density texture only how many boids are in each patch of the
+ * world.
+ */
+enum class RenderDetail { kTriangles, kPoints, kDensity };
+
+/**
+ * Pannable and zoomable view of the world. The world point at center is drawn
+ * in the middle of the viewport, and zoom is how many pixels one unit of the
+ * world covers.
+ */
+class Camera2D {
+public:
+  /**
+   * Default constructor for Camera2D, showing a 1x1 viewport at the origin
+   */
+  Camera2D();
+
+  /**
+   * Constructor for Camera2D
+   */
+  Camera2D(const glm::vec2 &viewport_size, const glm::vec2 &center,
+           float zoom = 1.0f);
+
+  /**
+   * Drags the world along with the cursor by screen_offset pixels
+   */
+  void Pan(const glm::vec2 &screen_offset);
+
+  /**
+   * Multiplies the zoom by factor, keeping the world point under screen_point
+   * in place. The zoom stays between kMinZoom and kMaxZoom.
+   */
+  void ZoomAt(const glm::vec2 &screen_point, float factor);
+
+  glm::vec2 ScreenToWorld(const glm::vec2 &screen_point) const;
+
+  glm::vec2 WorldToScreen(const glm::vec2 &world_point) const;
+
+  /**
+   * Corners of the part of the world that is inside the viewport
+   */
+  void VisibleRect(glm::vec2 &min_corner, glm::vec2 &max_corner) const;
+
+  /**
+   * Cheapest detail that still looks right for boids of body_radius at the
+   * current zoom. Boids only a couple of pixels across are drawn as points,
+   * and once they shrink below a pixel as a density texture.
+   */
+  RenderDetail DetailFor(float body_radius) const;
+
+  const glm::vec2 &viewport_size() const;
+
+  /**
+   * Resizes the viewport, such as when the window is resized, keeping the
+   * same center and zoom
+   */
+  void set_viewport_size(const glm::vec2 &viewport_size);
+
+  const glm::vec2 &center() const;
+
+  void set_center(const glm::vec2 &center);
+
+  float zoom() const;
+
+  void set_zoom(float zoom);
+
+  static const float kMinZoom;
+  static const float kMaxZoom;
+
+private:
+  glm::vec2 viewport_size_;
+  glm::vec2 center_;
+  float zoom_;
+};
+
+} // namespace visualizer
+
+} // namespace boid_sim
@@ -0,0 +1,238 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <cmath>
+#include <stdexcept>
+
+#include "core/basic_boid.h"
+
+namespace boid_sim {
+
+float AxisBoundsSteering(float coordinate, float min_bound, float max_bound,
+                         float fov_radius, float max_force) {
+  float component = 0.0f;
+
+  float dist_min = std::abs(coordinate - min_bound);
+  float dist_max = std::abs(coordinate - max_bound);
+
+  bool min_bound_in_fov = dist_min < fov_radius;
+  bool max_bound_in_fov = dist_max < fov_radius;
+  bool out_of_min_bound = coordinate <= min_bound;
+  bool out_of_max_bound = coordinate >= max_bound;
+
+  if (min_bound_in_fov || out_of_min_bound) {
+    component = max_force / (dist_min / fov_radius);
+
+    if (out_of_min_bound) {
+      // Off screen, make steering force component massive;
+      component = 1.0f / kSteeringEpsilon;
+    }
+  } else if (max_bound_in_fov || out_of_max_bound) {
+    component = -max_force / (dist_max / fov_radius);
+
+    if (out_of_max_bound) {
+      // Off screen, make steering force component massive;
+      component = -1.0f / kSteeringEpsilon;
+    }
+  }
+
+  return component;
+}
+
+template <int Dim>
+BasicBoid<Dim>::BasicBoid(int id, const Vector &position,
+                          const Vector &direction, float max_speed,
+                          float fov_radius)
+    : id_(id), position_(position) {
+  if (max_speed < 0.0f) {
+    throw std::invalid_argument("Max speed was less than 0!");
+  } else if (fov_radius < 0.0f) {
+    throw std::invalid_argument("FOV radius was less than 0!");
+  }
+
+  max_speed_ = max_speed;
+  fov_radius_ = fov_radius;
+  velocity_ = glm::normalize(direction) * max_speed_;
+  float max_for_speed_percent = .20f;
+  max_force_ = max_for_speed_percent * max_speed_;
+}
+
+template <int Dim>
+void BasicBoid<Dim>::UpdatePosition(
+    const std::vector<std::vector<float>> &container_bounds,
+    const std::vector<BasicBoid> &neighbors, float align_percent,
+    float cohesion_percent, float separation_percent) {
+  UpdatePosition(container_bounds, SumNeighbors(neighbors), align_percent,
+                 cohesion_percent, separation_percent);
+}
+
+template <int Dim>
+void BasicBoid<Dim>::UpdatePosition(
+    const std::vector<std::vector<float>> &container_bounds,
+    const NeighborSums &sums, float align_percent, float cohesion_percent,
+    float separation_percent) {
+  Vector acceleration =
+      Flock(sums, align_percent, cohesion_percent, separation_percent);
+
+  if (container_bounds.empty()) {
+    FixZeroComponentVelocity();
+  } else {
+    acceleration += SteerInbounds(container_bounds);
+  }
+
+  Integrate(acceleration, 1.0f);
+}
+
+template <int Dim>
+void BasicBoid<Dim>::AddNeighbor(const Vector &position,
+                                 const Vector &velocity,
+                                 NeighborSums &sums) const {
+  sums.num_visible++;
+  sums.velocity += velocity;
+  sums.position += position;
+
+  float distance = glm::distance(position_, position);
+  if (distance > 0) {
+    Vector direction_away = position_ - position;
+    direction_away = glm::normalize(direction_away);
+    direction_away /= (distance / fov_radius_);
+    sums.away += direction_away;
+    sums.num_apart++;
+  }
+}
+
+template <int Dim>
+const typename BasicBoid<Dim>::Vector &BasicBoid<Dim>::position() const {
+  return position_;
+}
+
+template <int Dim> void BasicBoid<Dim>::set_position(const Vector &position) {
+  position_ = position;
+}
+
+template <int Dim>
+const typename BasicBoid<Dim>::Vector &BasicBoid<Dim>::velocity() const {
+  return velocity_;
+}
+
+template <int Dim> void BasicBoid<Dim>::set_velocity(const Vector &velocity) {
+  velocity_ = velocity;
+}
+
+template <int Dim> int BasicBoid<Dim>::id() const { return id_; }
+
+template <int Dim> float BasicBoid<Dim>::max_speed() const {
+  return max_speed_;
+}
+
+template <int Dim> float BasicBoid<Dim>::fov_radius() const {
+  return fov_radius_;
+}
+
+template <int Dim> bool BasicBoid<Dim>::Sees(const BasicBoid &boid) const {
+  // Only a boid identical to this one is left out, the same as Boid does
+  bool is_self = boid.id_ == id_ && boid.position_ == position_ &&
+                 boid.velocity_ == velocity_;
+
+  return glm::distance(position_, boid.position_) < fov_radius_ && !is_self;
+}
+
+template <int Dim>
+typename BasicBoid<Dim>::NeighborSums
+BasicBoid<Dim>::SumNeighbors(const std::vector<BasicBoid> &neighbors) const {
+  // Summed in the order they are given, without copying them out first
+  NeighborSums sums;
+
+  for (const BasicBoid &boid : neighbors) {
+    if (Sees(boid)) {
+      AddNeighbor(boid.position_, boid.velocity_, sums);
+    }
+  }
+
+  return sums;
+}
+
+template <int Dim>
+typename BasicBoid<Dim>::Vector
+BasicBoid<Dim>::Flock(const NeighborSums &sums, float align_percent,
+                      float cohesion_percent,
+                      float separation_percent) const {
+  Vector align_force =
+      CalcSteerForce(sums.velocity / (float)sums.num_visible);
+
+  Vector cohes_force(0.0f);
+  if (sums.position != position_) {
+    cohes_force =
+        CalcSteerForce(sums.position / (float)sums.num_visible - position_);
+  }
+
+  Vector sep_force(0.0f);
+  if (sums.num_apart > 0) {
+    sep_force = CalcSteerForce(sums.away / (float)sums.num_apart);
+  }
+
+  Vector accel_force =
+      (align_force * align_percent + cohes_force * cohesion_percent +
+       sep_force * separation_percent);
+
+  if (glm::length(accel_force) > max_force_) {
+    accel_force = glm::normalize(accel_force) * max_force_;
+  }
+
+  return accel_force;
+}
+
+template <int Dim>
+typename BasicBoid<Dim>::Vector BasicBoid<Dim>::SteerInbounds(
+    const std::vector<std::vector<float>> &container_bounds) {
+  Vector steering_force(0.0f);
+
+  FixZeroComponentVelocity();
+  for (int axis = 0; axis < Dim; axis++) {
+    steering_force[axis] = AxisBoundsSteering(
+        position_[axis], container_bounds[axis][0], container_bounds[axis][1],
+        fov_radius_, max_force_);
+  }
+
+  return steering_force;
+}
+
+template <int Dim>
+typename BasicBoid<Dim>::Vector
+BasicBoid<Dim>::CalcSteerForce(const Vector &desired_direction) const {
+  Vector steer_force(0.0f);
+
+  if (glm::length(desired_direction) > 0) {
+    steer_force = glm::normalize(desired_direction);
+    steer_force *= max_speed_;
+    steer_force -= velocity_;
+  }
+
+  return steer_force;
+}
+
+template <int Dim> void BasicBoid<Dim>::FixZeroComponentVelocity() {
+  /*
+   * Boid algorithm works in such a way that boids with perfect 0 velocity
+   * components will ignore their components respective bounds. Epsilon is
+   * added to fix this.
+   */
+  for (int axis = 0; axis < Dim; axis++) {
+    if (velocity_[axis] == 0.0f) {
+      velocity_[axis] = kSteeringEpsilon;
+    }
+  }
+}
+
+template <int Dim>
+void BasicBoid<Dim>::Integrate(const Vector &acceleration, float time_step) {
+  velocity_ += acceleration * time_step;
+  velocity_ = glm::normalize(velocity_) * max_speed_;
+
+  position_ += velocity_ * time_step;
+}
+
+template class BasicBoid<2>;
+template class BasicBoid<3>;
+
+} // namespace boid_sim
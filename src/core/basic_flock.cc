@@ -0,0 +1,142 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+
+#include "core/basic_flock.h"
+#include "core/parallel_for.h"
+#include "core/swarm_rng.h"
+
+namespace boid_sim {
+
+template <int Dim>
+BasicFlock<Dim>::BasicFlock(
+    const std::vector<std::vector<float>> &container_bounds,
+    const std::vector<BasicBoid<Dim>> &boids,
+    const FlockingParams &flocking_params)
+    : container_bounds_(container_bounds), flocking_params_(flocking_params),
+      boids_(boids) {}
+
+template <int Dim> void BasicFlock<Dim>::AdvanceOnFrame() {
+  // Every boid steers from this snapshot, like in BoidContainer
+  std::vector<BasicBoid<Dim>> boid_snapshot = boids_;
+
+  positions_.resize(boid_snapshot.size());
+  candidate_counts_.assign(boid_snapshot.size(), 0);
+  float max_fov_radius = 0.0f;
+
+  for (size_t i = 0; i < boid_snapshot.size(); i++) {
+    positions_[i] = boid_snapshot[i].position();
+    max_fov_radius = std::max(max_fov_radius, boid_snapshot[i].fov_radius());
+  }
+
+  grid_.Build(positions_, container_bounds_, max_fov_radius);
+
+  ParallelFor(0, boids_.size(), num_threads_, [&](size_t begin, size_t end) {
+    std::vector<size_t> candidates;
+    std::vector<BasicBoid<Dim>> neighbors;
+
+    for (size_t i = begin; i < end; i++) {
+      BasicBoid<Dim> &boid = boids_[i];
+      grid_.Gather(boid.position(), boid.fov_radius(), candidates);
+      candidate_counts_[i] = candidates.size();
+
+      // Cells are in index order, and only boids in range are copied
+      neighbors.clear();
+      for (size_t candidate : candidates) {
+        if (glm::distance(boid.position(), positions_[candidate]) <
+            boid.fov_radius()) {
+          neighbors.push_back(boid_snapshot[candidate]);
+        }
+      }
+
+      std::sort(neighbors.begin(), neighbors.end(),
+                [](const BasicBoid<Dim> &boid1, const BasicBoid<Dim> &boid2) {
+                  return boid1.id() < boid2.id();
+                });
+
+      boid.UpdatePosition(container_bounds_, neighbors,
+                          flocking_params_.align_percent,
+                          flocking_params_.cohesion_percent,
+                          flocking_params_.separation_percent);
+    }
+  });
+}
+
+template <int Dim> void BasicFlock<Dim>::set_num_threads(size_t num_threads) {
+  num_threads_ = std::max<size_t>(1, num_threads);
+}
+
+template <int Dim> size_t BasicFlock<Dim>::num_threads() const {
+  return num_threads_;
+}
+
+template <int Dim> double BasicFlock<Dim>::mean_candidates() const {
+  if (candidate_counts_.empty()) {
+    return 0.0;
+  }
+
+  double total = 0.0;
+  for (size_t count : candidate_counts_) {
+    total += (double)count;
+  }
+
+  return total / (double)candidate_counts_.size();
+}
+
+template <int Dim>
+const std::vector<BasicBoid<Dim>> &BasicFlock<Dim>::boids() const {
+  return boids_;
+}
+
+template <int Dim>
+const std::vector<std::vector<float>> &
+BasicFlock<Dim>::container_bounds() const {
+  return container_bounds_;
+}
+
+template <int Dim>
+std::vector<BasicBoid<Dim>>
+SpawnBasicSwarm(const std::vector<std::vector<float>> &container_bounds,
+                size_t num_boids, uint64_t seed,
+                const FlockingParams &flocking_params) {
+  typedef typename VectorOf<Dim>::type Vector;
+
+  SwarmRng rng(seed);
+  std::vector<BasicBoid<Dim>> boids;
+  boids.reserve(num_boids);
+
+  for (size_t i = 0; i < num_boids; i++) {
+    Vector position(0.0f);
+    Vector direction(0.0f);
+
+    for (int axis = 0; axis < Dim; axis++) {
+      position[axis] =
+          rng.Uniform(i, axis, container_bounds[axis][0],
+                      container_bounds[axis][1]);
+      direction[axis] = rng.Uniform(i, Dim + axis, -1.0f, 1.0f);
+    }
+
+    if (glm::length(direction) == 0.0f) {
+      direction[0] = 1.0f;
+    }
+
+    boids.push_back(BasicBoid<Dim>((int)i, position, direction,
+                                   flocking_params.max_speed,
+                                   flocking_params.fov_radius));
+  }
+
+  return boids;
+}
+
+template class BasicFlock<2>;
+template class BasicFlock<3>;
+
+template std::vector<BasicBoid<2>>
+SpawnBasicSwarm<2>(const std::vector<std::vector<float>> &, size_t, uint64_t,
+                   const FlockingParams &);
+template std::vector<BasicBoid<3>>
+SpawnBasicSwarm<3>(const std::vector<std::vector<float>> &, size_t, uint64_t,
+                   const FlockingParams &);
+
+} // namespace boid_sim
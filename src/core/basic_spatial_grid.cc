@@ -0,0 +1,267 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+
+#include "core/basic_spatial_grid.h"
+#include "core/parallel_for.h"
+
+namespace boid_sim {
+
+namespace {
+
+const double kMinCells = 1 << 16;
+const double kMaxCellsPerPosition = 64.0;
+
+} // namespace
+
+template <int Dim>
+BasicSpatialGrid<Dim>::BasicSpatialGrid() : BasicSpatialGrid(true) {}
+
+template <int Dim>
+BasicSpatialGrid<Dim>::BasicSpatialGrid(bool limit_cells)
+    : limit_cells_(limit_cells), origin_(0.0f), cell_size_(1.0f),
+      cell_starts_(2, 0), atomic_cursors_size_(0) {
+  for (int axis = 0; axis < Dim; axis++) {
+    cells_along_[axis] = 1;
+    strides_[axis] = 1;
+  }
+}
+
+template <int Dim>
+BasicSpatialGrid<Dim>::BasicSpatialGrid(const BasicSpatialGrid &source)
+    : atomic_cursors_size_(0) {
+  *this = source;
+}
+
+template <int Dim>
+BasicSpatialGrid<Dim> &
+BasicSpatialGrid<Dim>::operator=(const BasicSpatialGrid &source) {
+  // Scatter cursors are scratch space and get rebuilt on the next Build
+  limit_cells_ = source.limit_cells_;
+  origin_ = source.origin_;
+  cell_size_ = source.cell_size_;
+  for (int axis = 0; axis < Dim; axis++) {
+    cells_along_[axis] = source.cells_along_[axis];
+    strides_[axis] = source.strides_[axis];
+  }
+
+  cell_of_ = source.cell_of_;
+  cell_starts_ = source.cell_starts_;
+  entries_ = source.entries_;
+
+  return *this;
+}
+
+template <int Dim>
+void BasicSpatialGrid<Dim>::Build(
+    const std::vector<Vector> &positions,
+    const std::vector<std::vector<float>> &container_bounds, float cell_size,
+    size_t num_threads) {
+  Vector min_corner(0.0f);
+  Vector max_corner(0.0f);
+
+  if (!container_bounds.empty()) {
+    for (int axis = 0; axis < Dim; axis++) {
+      min_corner[axis] = container_bounds[axis][0];
+      max_corner[axis] = container_bounds[axis][1];
+    }
+  } else if (!positions.empty()) {
+    min_corner = positions[0];
+    max_corner = positions[0];
+
+    for (const Vector &position : positions) {
+      for (int axis = 0; axis < Dim; axis++) {
+        min_corner[axis] = std::min(min_corner[axis], position[axis]);
+        max_corner[axis] = std::max(max_corner[axis], position[axis]);
+      }
+    }
+  }
+
+  origin_ = min_corner;
+  cell_size_ = cell_size > 0.0f ? cell_size : 1.0f;
+
+  // Bigger cells still find every neighbor, and keep a spread out swarm from
+  // needing more cells than memory allows
+  double max_cells = std::max<double>(kMinCells, kMaxCellsPerPosition *
+                                                     (double)positions.size());
+  while (limit_cells_) {
+    double cells = 1.0;
+    for (int axis = 0; axis < Dim; axis++) {
+      cells *= std::ceil((max_corner[axis] - min_corner[axis]) / cell_size_);
+    }
+
+    if (!(cells > max_cells)) {
+      break;
+    }
+
+    cell_size_ *= 2.0f;
+  }
+
+  size_t num_cells = 1;
+  for (int axis = 0; axis < Dim; axis++) {
+    float extent = max_corner[axis] - min_corner[axis];
+    cells_along_[axis] =
+        std::max<size_t>(1, (size_t)std::ceil(extent / cell_size_));
+    strides_[axis] = num_cells;
+    num_cells *= cells_along_[axis];
+  }
+
+  size_t num_positions = positions.size();
+  cell_of_.resize(num_positions);
+  entries_.resize(num_positions);
+  cell_starts_.assign(num_cells + 1, 0);
+
+  if (num_threads <= 1) {
+    // Counting sort, which keeps every cell in ascending index order
+    for (size_t i = 0; i < num_positions; i++) {
+      cell_of_[i] = CellOf(positions[i]);
+      cell_starts_[cell_of_[i] + 1]++;
+    }
+
+    for (size_t cell = 0; cell < num_cells; cell++) {
+      cell_starts_[cell + 1] += cell_starts_[cell];
+    }
+
+    cursors_.assign(cell_starts_.begin(), cell_starts_.end() - 1);
+    for (size_t i = 0; i < num_positions; i++) {
+      entries_[cursors_[cell_of_[i]]++] = i;
+    }
+
+    return;
+  }
+
+  if (atomic_cursors_size_ < num_cells) {
+    atomic_cursors_.reset(new std::atomic<size_t>[num_cells]);
+    atomic_cursors_size_ = num_cells;
+  }
+
+  for (size_t cell = 0; cell < num_cells; cell++) {
+    atomic_cursors_[cell].store(0, std::memory_order_relaxed);
+  }
+
+  ParallelFor(0, num_positions, num_threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      cell_of_[i] = CellOf(positions[i]);
+      atomic_cursors_[cell_of_[i]].fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  for (size_t cell = 0; cell < num_cells; cell++) {
+    size_t count = atomic_cursors_[cell].load(std::memory_order_relaxed);
+    cell_starts_[cell + 1] = cell_starts_[cell] + count;
+    atomic_cursors_[cell].store(cell_starts_[cell], std::memory_order_relaxed);
+  }
+
+  ParallelFor(0, num_positions, num_threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      size_t slot =
+          atomic_cursors_[cell_of_[i]].fetch_add(1, std::memory_order_relaxed);
+      entries_[slot] = i;
+    }
+  });
+}
+
+template <int Dim>
+void BasicSpatialGrid<Dim>::Gather(const Vector &center, float radius,
+                                   std::vector<size_t> &indices) const {
+  indices.clear();
+
+  size_t min_coordinate[Dim];
+  size_t max_coordinate[Dim];
+  size_t coordinate[Dim];
+
+  for (int axis = 0; axis < Dim; axis++) {
+    min_coordinate[axis] = CoordinateOf(center[axis] - radius, axis);
+    max_coordinate[axis] = CoordinateOf(center[axis] + radius, axis);
+    coordinate[axis] = min_coordinate[axis];
+  }
+
+  /*
+   * Cells along the first axis are contiguous, so every line of the block is
+   * copied as one span while the other axes count through the block like an
+   * odometer.
+   */
+  while (true) {
+    size_t line = 0;
+    for (int axis = 1; axis < Dim; axis++) {
+      line += coordinate[axis] * strides_[axis];
+    }
+
+    size_t first = cell_starts_[line + min_coordinate[0]];
+    size_t last = cell_starts_[line + max_coordinate[0] + 1];
+    indices.insert(indices.end(), entries_.begin() + first,
+                   entries_.begin() + last);
+
+    int axis = 1;
+    while (axis < Dim && coordinate[axis] == max_coordinate[axis]) {
+      coordinate[axis] = min_coordinate[axis];
+      axis++;
+    }
+
+    if (axis == Dim) {
+      break;
+    }
+
+    coordinate[axis]++;
+  }
+}
+
+template <int Dim>
+size_t BasicSpatialGrid<Dim>::CellOf(const Vector &position) const {
+  size_t cell = 0;
+  for (int axis = 0; axis < Dim; axis++) {
+    cell += CoordinateOf(position[axis], axis) * strides_[axis];
+  }
+
+  return cell;
+}
+
+template <int Dim>
+const std::vector<size_t> &BasicSpatialGrid<Dim>::cell_starts() const {
+  return cell_starts_;
+}
+
+template <int Dim>
+const std::vector<size_t> &BasicSpatialGrid<Dim>::entries() const {
+  return entries_;
+}
+
+template <int Dim>
+size_t BasicSpatialGrid<Dim>::cells_along(int axis) const {
+  return cells_along_[axis];
+}
+
+template <int Dim> size_t BasicSpatialGrid<Dim>::num_cells() const {
+  return cell_starts_.size() - 1;
+}
+
+template <int Dim> float BasicSpatialGrid<Dim>::cell_size() const {
+  return cell_size_;
+}
+
+template <int Dim>
+const typename BasicSpatialGrid<Dim>::Vector &
+BasicSpatialGrid<Dim>::origin() const {
+  return origin_;
+}
+
+template <int Dim>
+size_t BasicSpatialGrid<Dim>::CoordinateOf(float value, int axis) const {
+  // NaN goes to the first cell
+  float coordinate = std::floor((value - origin_[axis]) / cell_size_);
+
+  if (!(coordinate >= 0.0f)) {
+    return 0;
+  } else if (coordinate >= (float)(cells_along_[axis] - 1)) {
+    return cells_along_[axis] - 1;
+  }
+
+  return (size_t)coordinate;
+}
+
+template class BasicSpatialGrid<2>;
+template class BasicSpatialGrid<3>;
+
+} // namespace boid_sim
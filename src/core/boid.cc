@@ -2,34 +2,21 @@
 // Created by Kaelan Davis on 4/19/2021.
 //
 
+#include <array>
 #include <cmath>
+#include <stdexcept>
 
 #include "core/boid.h"
 
 namespace boid_sim {
 boid_sim::Boid::Boid(int id, glm::vec2 &position, glm::vec2 &direction,
                      float max_speed, float fov_radius, float body_radius)
-    : id_(id), position_(position) {
-  ValidateValues(max_speed, fov_radius, body_radius);
-  max_speed_ = max_speed;
-  fov_radius_ = fov_radius;
+    : BasicBoid<2>(id, position, direction, max_speed, fov_radius) {
+  ValidateValues(body_radius);
   body_radius_ = body_radius;
+  view_angle_ = 360.0f;
   seek_mouse_ = false;
-  velocity_ = glm::normalize(direction) * max_speed_;
-  float max_for_speed_percent = .20f;
-  max_force_ = max_for_speed_percent * max_speed_;
-}
-
-Boid &Boid::operator=(const Boid &source) {
-  body_radius_ = source.body_radius_;
-  max_speed_ = source.max_speed_;
-  max_force_ = source.max_force_;
-  fov_radius_ = source.max_force_;
-  id_ = source.id_;
-  position_ = source.position_;
-  velocity_ = source.velocity_;
-
-  return *this;
+  role_ = BoidRole::kPrey;
 }
 
 bool operator!=(const Boid &boid1, const Boid &boid2) {
@@ -45,8 +32,12 @@ bool operator!=(const Boid &boid1, const Boid &boid2) {
 }
 
 void Boid::Draw() {
-  std::vector<glm::vec2> vertices = CalculateVertices();
-  ci::gl::color(ci::Color("MediumAquamarine"));
+  std::array<glm::vec2, 3> vertices = CalculateVertices();
+  if (role_ == BoidRole::kPredator) {
+    ci::gl::color(ci::Color("OrangeRed"));
+  } else {
+    ci::gl::color(ci::Color("MediumAquamarine"));
+  }
   ci::gl::drawSolidTriangle(vertices[0], vertices[1], vertices[2]);
 
   ci::gl::color(ci::Color("Red"));
@@ -55,97 +46,63 @@ void Boid::Draw() {
 }
 
 void Boid::UpdatePosition(std::vector<std::vector<float>> &container_bounds,
-                          std::vector<Boid> &boids, glm::vec2 &mouse_pos,
+                          BoidSpan boids, glm::vec2 &mouse_pos,
                           float align_percent, float cohesion_percent,
-                          float separation_percent) {
-  glm::vec2 acceleration = Flock(boids, mouse_pos, align_percent,
-                                 cohesion_percent, separation_percent) +
-                           SteerInbounds(container_bounds);
-
-  if (seek_mouse_) {
-    acceleration += Seek(mouse_pos);
-  }
-
-  velocity_ += acceleration;
-  velocity_ = glm::normalize(velocity_) * max_speed_;
-
-  position_ += velocity_;
+                          float separation_percent,
+                          const glm::vec2 &external_force, float time_step) {
+  UpdatePosition(container_bounds, SumBoidsInVision(boids), mouse_pos,
+                 align_percent, cohesion_percent, separation_percent,
+                 external_force, time_step);
 }
 
-glm::vec2 Boid::Flock(std::vector<Boid> &boids, glm::vec2 &mouse_pos,
-                      float align_percent, float cohesion_percent,
-                      float separation_percent) {
-  std::vector<Boid> boids_in_fov = GetBoidsInVision(boids);
-
-  glm::vec2 align_force = Align(boids_in_fov);
-  glm::vec2 cohes_force = Cohesion(boids_in_fov);
-  glm::vec2 sep_force = Separation(boids_in_fov);
-
-  glm::vec2 accel_force =
-      (align_force * align_percent + cohes_force * cohesion_percent +
-       sep_force * separation_percent);
-
-  if (glm::length(accel_force) > max_force_) {
-    accel_force = glm::normalize(accel_force) * max_force_;
-  }
-
-  return accel_force;
+void Boid::UpdatePosition(const ObstacleField &obstacle_field,
+                          BoidSpan boids, glm::vec2 &mouse_pos,
+                          float align_percent, float cohesion_percent,
+                          float separation_percent,
+                          const glm::vec2 &external_force, float time_step) {
+  UpdatePosition(obstacle_field, SumBoidsInVision(boids), mouse_pos,
+                 align_percent, cohesion_percent, separation_percent,
+                 external_force, time_step);
 }
 
-glm::vec2 Boid::Align(std::vector<Boid> &boids) {
-  glm::vec2 desired_direction(0, 0);
+void Boid::UpdatePosition(std::vector<std::vector<float>> &container_bounds,
+                          const NeighborSums &sums, glm::vec2 &mouse_pos,
+                          float align_percent, float cohesion_percent,
+                          float separation_percent,
+                          const glm::vec2 &external_force, float time_step) {
+  glm::vec2 acceleration =
+      Flock(sums, align_percent, cohesion_percent, separation_percent);
 
-  for (const Boid &boid : boids) {
-    desired_direction += boid.velocity_;
+  if (container_bounds.empty()) {
+    FixZeroComponentVelocity();
+  } else {
+    acceleration += SteerInbounds(container_bounds);
   }
 
-  desired_direction /= (float)boids.size();
-  glm::vec2 steer_force = CalcSteerForce(desired_direction);
-
-  return steer_force;
+  Move(acceleration, mouse_pos, external_force, time_step);
 }
 
-glm::vec2 Boid::Cohesion(std::vector<Boid> &boids) {
-  glm::vec2 avg_position(0, 0);
-  glm::vec2 steer_force(0, 0);
-
-  for (const Boid &boid : boids) {
-    avg_position += boid.position();
-  }
-
-  if (avg_position != position_) {
-    avg_position /= (float)boids.size();
-    glm::vec2 desired_direction = avg_position - position_;
-
-    steer_force = CalcSteerForce(desired_direction);
-  }
+void Boid::UpdatePosition(const ObstacleField &obstacle_field,
+                          const NeighborSums &sums, glm::vec2 &mouse_pos,
+                          float align_percent, float cohesion_percent,
+                          float separation_percent,
+                          const glm::vec2 &external_force, float time_step) {
+  glm::vec2 acceleration =
+      Flock(sums, align_percent, cohesion_percent, separation_percent);
+  acceleration += AvoidObstacles(obstacle_field);
 
-  return steer_force;
+  Move(acceleration, mouse_pos, external_force, time_step);
 }
 
-glm::vec2 Boid::Separation(std::vector<Boid> &boids) {
-  glm::vec2 desired_direction(0, 0);
-  glm::vec2 steer_force(0, 0);
-  size_t total = 0;
-
-  for (const Boid &boid : boids) {
-    float distance = glm::distance(position_, boid.position());
-
-    if (distance > 0) {
-      glm::vec2 direction_away = position_ - boid.position();
-      direction_away = glm::normalize(direction_away);
-      direction_away /= (distance / fov_radius_);
-      desired_direction += direction_away;
-      total++;
-    }
+void Boid::Move(glm::vec2 &acceleration, glm::vec2 &mouse_pos,
+                const glm::vec2 &external_force, float time_step) {
+  if (seek_mouse_) {
+    acceleration += Seek(mouse_pos);
   }
 
-  if (total > 0) {
-    desired_direction /= (float)total;
-    steer_force = CalcSteerForce(desired_direction);
-  }
+  acceleration += external_force;
 
-  return steer_force;
+  Integrate(acceleration, time_step);
 }
 
 glm::vec2 Boid::Seek(glm::vec2 &desired_position) {
@@ -153,109 +110,59 @@ glm::vec2 Boid::Seek(glm::vec2 &desired_position) {
   glm::vec2 steer_force;
 
   if (distance < fov_radius_) {
-    glm::vec2 desired_direction = desired_position - position_;
-    steer_force = CalcSteerForce(desired_direction);
-  }
-
-  if (glm::length(steer_force) > max_force_) {
-    steer_force = glm::normalize(steer_force) * max_force_;
+    steer_force = Pursue(desired_position);
   }
 
   return steer_force;
 }
 
-glm::vec2
-Boid::SteerInbounds(std::vector<std::vector<float>> &container_bounds) {
-  glm::vec2 steering_force(0, 0);
+glm::vec2 Boid::Pursue(const glm::vec2 &target) {
+  glm::vec2 desired_direction = target - position_;
+  glm::vec2 steer_force = CalcSteerForce(desired_direction);
 
-  FixZeroComponentVelocity();
-  steering_force[0] = HandleHorizontalBounds(container_bounds);
-  steering_force[1] = HandleVerticalBounds(container_bounds);
+  if (glm::length(steer_force) > max_force_) {
+    steer_force = glm::normalize(steer_force) * max_force_;
+  }
 
-  return steering_force;
+  return steer_force;
 }
 
-float Boid::HandleHorizontalBounds(
-    std::vector<std::vector<float>> &container_bounds) const {
-  float x_component = 0.0f;
-
-  float x_min_bound = container_bounds[0][0];
-  float x_max_bound = container_bounds[0][1];
-  float dist_x_min = std::abs(position_.x - x_min_bound);
-  float dist_x_max = std::abs(position_.x - x_max_bound);
-
-  bool min_bound_in_fov = dist_x_min < fov_radius_;
-  bool max_bound_in_fov = dist_x_max < fov_radius_;
-  bool out_of_min_bound = position_.x <= x_min_bound;
-  bool out_of_max_bound = position_.x >= x_max_bound;
-
-  if (min_bound_in_fov || out_of_min_bound) {
-    x_component = max_force_ / (dist_x_min / fov_radius_);
-
-    if (out_of_min_bound) {
-      // Off screen, make steering force component massive;
-      x_component = 1.0f / kEpsilon;
-    }
-  } else if (max_bound_in_fov || out_of_max_bound) {
-    x_component = -max_force_ / (dist_x_max / fov_radius_);
+glm::vec2 Boid::Flee(const glm::vec2 &threat) {
+  glm::vec2 desired_direction = position_ - threat;
+  glm::vec2 steer_force = CalcSteerForce(desired_direction);
 
-    if (out_of_max_bound) {
-      // Off screen, make steering force component massive;
-      x_component = -1.0f / kEpsilon;
-    }
+  if (glm::length(steer_force) > max_force_) {
+    steer_force = glm::normalize(steer_force) * max_force_;
   }
 
-  return x_component;
+  return steer_force;
 }
 
-float Boid::HandleVerticalBounds(
-    std::vector<std::vector<float>> &container_bounds) const {
-  float y_component = 0.0f;
-
-  float y_min_bound = container_bounds[1][0];
-  float y_max_bound = container_bounds[1][1];
-  float dist_y_min = std::abs(position_.y - y_min_bound);
-  float dist_y_max = std::abs(position_.y - y_max_bound);
-
-  bool min_bound_in_fov = dist_y_min < fov_radius_;
-  bool max_bound_in_fov = dist_y_max < fov_radius_;
-  bool out_of_min_bound = position_.y <= y_min_bound;
-  bool out_of_max_bound = position_.y >= y_max_bound;
-
-  if (min_bound_in_fov || out_of_min_bound) {
-    y_component = max_force_ / (dist_y_min / fov_radius_);
+glm::vec2 Boid::AvoidObstacles(const ObstacleField &obstacle_field) {
+  FixZeroComponentVelocity();
 
-    if (out_of_min_bound) {
-      // Off screen, make steering force component massive;
-      y_component = 1.0f / kEpsilon;
-    }
-  } else if (max_bound_in_fov || out_of_max_bound) {
-    y_component = -max_force_ / (dist_y_max / fov_radius_);
+  glm::vec2 gradient;
+  float distance = obstacle_field.Sample(position_, gradient);
 
-    if (out_of_max_bound) {
-      // Off screen, make steering force component massive;
-      y_component = -1.0f / kEpsilon;
-    }
+  if (distance >= fov_radius_ || glm::length(gradient) == 0.0f) {
+    return glm::vec2(0, 0);
   }
 
-  return y_component;
-}
-
-glm::vec2 Boid::CalcSteerForce(glm::vec2 &desired_direction) {
-  glm::vec2 steer_force(0, 0);
+  // Same falloff as the container walls, pushing straight away from the
+  // closest obstacle
+  glm::vec2 away = glm::normalize(gradient);
 
-  if (glm::length(desired_direction) > 0) {
-    steer_force = glm::normalize(desired_direction);
-    steer_force *= max_speed_;
-    steer_force -= velocity_;
+  if (distance <= 0.0f) {
+    // Inside an obstacle, make steering force massive;
+    return away / kSteeringEpsilon;
   }
 
-  return steer_force;
+  return away * (max_force_ / (distance / fov_radius_));
 }
 
-std::vector<glm::vec2> Boid::CalculateVertices() {
+std::array<glm::vec2, 3> Boid::CalculateVertices() {
   float num_vertices = 3.0f;
-  std::vector<glm::vec2> vertices;
+  std::array<glm::vec2, 3> vertices;
   float start_angle = GetVelocityAngle();
 
   for (size_t i = 0; i < num_vertices; i++) {
@@ -266,25 +173,28 @@ std::vector<glm::vec2> Boid::CalculateVertices() {
     float y =
         position_[1] + body_radius_ * std::sin(start_angle + adjust_angle);
 
-    glm::vec2 vertex(x, y);
-    vertices.push_back(vertex);
+    vertices[i] = glm::vec2(x, y);
   }
 
   return vertices;
 }
 
-std::vector<Boid> Boid::GetBoidsInVision(const std::vector<Boid> &boids) {
-  std::vector<Boid> boids_in_fov;
+Boid::NeighborSums Boid::SumBoidsInVision(BoidSpan boids) const {
+  // The rules only need sums over the boids in vision, so they are added up
+  // in one pass instead of copying those boids out first
+  NeighborSums sums;
+  VisionCone cone = vision_cone();
 
   for (const Boid &boid : boids) {
-    float distance = glm::distance(position_, boid.position());
+    float distance = glm::distance(position_, boid.position_);
 
-    if (distance < fov_radius_ && *this != boid) {
-      boids_in_fov.push_back(boid);
+    if (distance < fov_radius_ && cone.Contains(boid.position_) &&
+        *this != boid) {
+      AddNeighbor(boid.position_, boid.velocity_, sums);
     }
   }
 
-  return boids_in_fov;
+  return sums;
 }
 
 float Boid::GetVelocityAngle() {
@@ -309,41 +219,33 @@ float Boid::GetVelocityAngle() {
   return angle;
 }
 
-void Boid::FixZeroComponentVelocity() {
-  /*
-   * Boid algorithm works in such a way that boids with perfect 0 velocity
-   * components will ignore their components respective bounds. Epsilon is added
-   * to fix this.
-   */
-  if (velocity_[0] == 0.0f) {
-    velocity_[0] = kEpsilon;
-  }
-
-  if (velocity_[1] == 0.0f) {
-    velocity_[1] = kEpsilon;
-  }
-}
-
-void Boid::ValidateValues(float max_speed, float fov_radius,
-                          float body_radius) {
-  if (max_speed < 0.0f) {
-    throw std::invalid_argument("Max speed was less than 0!");
-  } else if (fov_radius < 0.0f) {
-    throw std::invalid_argument("FOV radius was less than 0!");
-  } else if (body_radius < 0.0f) {
+void Boid::ValidateValues(float body_radius) {
+  if (body_radius < 0.0f) {
     throw std::invalid_argument("Body radius was less than 0!");
   }
 }
 
-const glm::vec2 &Boid::position() const { return position_; }
+bool Boid::is_seek_mouse() const { return seek_mouse_; }
 
-void Boid::set_position(const glm::vec2 &position) { position_ = position; }
+void Boid::set_seek_mouse(bool seek_mouse) { seek_mouse_ = seek_mouse; }
 
-const glm::vec2 &Boid::velocity() const { return velocity_; }
+float Boid::body_radius() const { return body_radius_; }
 
-void Boid::set_velocity(const glm::vec2 &velocity) { velocity_ = velocity; }
+void Boid::set_view_angle(float view_angle) {
+  if (!(view_angle >= 0.0f && view_angle <= 360.0f)) {
+    throw std::invalid_argument("View angle was not between 0 and 360!");
+  }
 
-bool Boid::is_seek_mouse() const { return seek_mouse_; }
+  view_angle_ = view_angle;
+}
 
-void Boid::set_seek_mouse(bool seek_mouse) { seek_mouse_ = seek_mouse; }
+float Boid::view_angle() const { return view_angle_; }
+
+void Boid::set_role(BoidRole role) { role_ = role; }
+
+BoidRole Boid::role() const { return role_; }
+
+VisionCone Boid::vision_cone() const {
+  return VisionCone(position_, velocity_, view_angle_);
+}
 } // namespace boid_sim
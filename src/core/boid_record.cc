@@ -0,0 +1,61 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <cstring>
+
+#include "core/boid_record.h"
+
+namespace boid_sim {
+
+BoidRecord ToRecord(const Boid &boid) {
+  BoidRecord record;
+  record.id = boid.id();
+  record.position[0] = boid.position().x;
+  record.position[1] = boid.position().y;
+  record.velocity[0] = boid.velocity().x;
+  record.velocity[1] = boid.velocity().y;
+  record.max_speed = boid.max_speed();
+  record.fov_radius = boid.fov_radius();
+  record.body_radius = boid.body_radius();
+  record.view_angle = boid.view_angle();
+  record.seek_mouse = boid.is_seek_mouse() ? 1 : 0;
+  record.role = (int32_t)boid.role();
+
+  return record;
+}
+
+Boid FromRecord(const BoidRecord &record) {
+  glm::vec2 position(record.position[0], record.position[1]);
+
+  // The constructor rescales the direction, so the exact velocity is restored
+  // afterwards instead.
+  glm::vec2 direction(1.0f, 0.0f);
+  Boid boid(record.id, position, direction, record.max_speed,
+            record.fov_radius, record.body_radius);
+  boid.set_velocity(glm::vec2(record.velocity[0], record.velocity[1]));
+  boid.set_view_angle(record.view_angle);
+  boid.set_seek_mouse(record.seek_mouse != 0);
+  boid.set_role((BoidRole)record.role);
+
+  return boid;
+}
+
+uint64_t HashSwarm(const std::vector<Boid> &boids) {
+  // 64 bit FNV-1a
+  uint64_t hash = 0xCBF29CE484222325ULL;
+
+  for (const Boid &boid : boids) {
+    BoidRecord record = ToRecord(boid);
+    uint8_t bytes[sizeof(BoidRecord)];
+    std::memcpy(bytes, &record, sizeof(BoidRecord));
+
+    for (uint8_t byte : bytes) {
+      hash ^= byte;
+      hash *= 0x100000001B3ULL;
+    }
+  }
+
+  return hash;
+}
+
+} // namespace boid_sim
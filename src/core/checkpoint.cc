@@ -0,0 +1,229 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "core/boid_record.h"
+#include "core/checkpoint.h"
+
+namespace boid_sim {
+
+namespace {
+
+const char kCheckpointMagic[8] = {'B', 'O', 'I', 'D', 'C', 'K', 'P', 'T'};
+const uint32_t kCheckpointVersion = 5;
+
+/**
+ * Read-only view of a whole checkpoint file. Uses mmap where it is available
+ * so the boid records are never copied before being rebuilt.
+ */
+class CheckpointFile {
+public:
+  explicit CheckpointFile(const std::string &path) : data_(nullptr), size_(0) {
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Could not open checkpoint " + path);
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+      close(fd);
+      throw std::runtime_error("Could not read size of checkpoint " + path);
+    }
+
+    size_ = (size_t)file_stat.st_size;
+    if (size_ > 0) {
+      void *mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error("Could not map checkpoint " + path);
+      }
+
+      madvise(mapping, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<const uint8_t *>(mapping);
+    }
+
+    close(fd);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+      throw std::runtime_error("Could not open checkpoint " + path);
+    }
+
+    buffer_.resize((size_t)file.tellg());
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(buffer_.data()), buffer_.size());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+  }
+
+  ~CheckpointFile() {
+#ifndef _WIN32
+    if (data_ != nullptr) {
+      munmap(const_cast<uint8_t *>(data_), size_);
+    }
+#endif
+  }
+
+  CheckpointFile(const CheckpointFile &) = delete;
+  CheckpointFile &operator=(const CheckpointFile &) = delete;
+
+  const uint8_t *data() const { return data_; }
+
+  size_t size() const { return size_; }
+
+private:
+  const uint8_t *data_;
+  size_t size_;
+#ifdef _WIN32
+  std::vector<uint8_t> buffer_;
+#endif
+};
+
+} // namespace
+
+void WriteCheckpoint(const std::string &path, const CheckpointState &state,
+                     const std::vector<Boid> &boids,
+                     const std::vector<size_t> &neighbor_counts) {
+  CheckpointHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kCheckpointMagic, sizeof(header.magic));
+  header.version = kCheckpointVersion;
+  header.record_size = sizeof(BoidRecord);
+
+  for (size_t axis = 0; axis < 2; axis++) {
+    header.container_bounds[axis][0] = state.container_bounds[axis][0];
+    header.container_bounds[axis][1] = state.container_bounds[axis][1];
+  }
+
+  const FlockingParams &flocking_params = state.flocking_params;
+  header.align_percent = flocking_params.align_percent;
+  header.cohesion_percent = flocking_params.cohesion_percent;
+  header.separation_percent = flocking_params.separation_percent;
+  header.max_speed = flocking_params.max_speed;
+  header.fov_radius = flocking_params.fov_radius;
+  header.view_angle = flocking_params.view_angle;
+  header.predator_max_speed = flocking_params.predator_max_speed;
+  header.hunt_radius = flocking_params.hunt_radius;
+  header.flee_radius = flocking_params.flee_radius;
+  header.unbounded = state.unbounded ? 1 : 0;
+  header.rng_seed = state.rng.seed();
+  header.rng_counter = state.rng.counter();
+  header.frame_count = state.frame_count;
+  header.max_neighbors = state.fidelity.max_neighbors;
+  header.substeps = state.fidelity.substeps;
+  header.lod_neighbor_threshold = state.fidelity.lod_neighbor_threshold;
+  header.far_field_neighbor_threshold =
+      state.fidelity.far_field_neighbor_threshold;
+  header.num_boids = boids.size();
+  header.num_neighbor_counts = neighbor_counts.size();
+
+  std::vector<BoidRecord> records;
+  records.reserve(boids.size());
+
+  for (const Boid &boid : boids) {
+    records.push_back(ToRecord(boid));
+  }
+
+  std::vector<uint64_t> counts(neighbor_counts.begin(), neighbor_counts.end());
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::runtime_error("Could not create checkpoint " + path);
+  }
+
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char *>(records.data()),
+             records.size() * sizeof(BoidRecord));
+  file.write(reinterpret_cast<const char *>(counts.data()),
+             counts.size() * sizeof(uint64_t));
+
+  if (!file) {
+    throw std::runtime_error("Could not write checkpoint " + path);
+  }
+}
+
+void ReadCheckpoint(const std::string &path, CheckpointState &state,
+                    std::vector<Boid> &boids,
+                    std::vector<size_t> &neighbor_counts) {
+  CheckpointFile file(path);
+
+  CheckpointHeader header;
+  if (file.size() < sizeof(header)) {
+    throw std::invalid_argument("Checkpoint " + path + " is truncated!");
+  }
+
+  std::memcpy(&header, file.data(), sizeof(header));
+
+  // Sizes are checked one part at a time so a corrupt count cannot overflow
+  size_t body_size = file.size() - sizeof(header);
+  if (std::memcmp(header.magic, kCheckpointMagic, sizeof(header.magic)) != 0) {
+    throw std::invalid_argument(path + " is not a checkpoint!");
+  } else if (header.version != kCheckpointVersion ||
+             header.record_size != sizeof(BoidRecord)) {
+    throw std::invalid_argument("Checkpoint " + path +
+                                " was written by another version!");
+  } else if (body_size / sizeof(BoidRecord) < header.num_boids ||
+             (body_size - header.num_boids * sizeof(BoidRecord)) /
+                     sizeof(uint64_t) <
+                 header.num_neighbor_counts) {
+    throw std::invalid_argument("Checkpoint " + path + " is truncated!");
+  }
+
+  state.container_bounds = {
+      {header.container_bounds[0][0], header.container_bounds[0][1]},
+      {header.container_bounds[1][0], header.container_bounds[1][1]}};
+
+  FlockingParams &flocking_params = state.flocking_params;
+  flocking_params.align_percent = header.align_percent;
+  flocking_params.cohesion_percent = header.cohesion_percent;
+  flocking_params.separation_percent = header.separation_percent;
+  flocking_params.max_speed = header.max_speed;
+  flocking_params.fov_radius = header.fov_radius;
+  flocking_params.view_angle = header.view_angle;
+  flocking_params.predator_max_speed = header.predator_max_speed;
+  flocking_params.hunt_radius = header.hunt_radius;
+  flocking_params.flee_radius = header.flee_radius;
+  state.unbounded = header.unbounded != 0;
+  state.rng = SwarmRng(header.rng_seed, header.rng_counter);
+  state.frame_count = header.frame_count;
+  state.fidelity.max_neighbors = header.max_neighbors;
+  state.fidelity.substeps = header.substeps;
+  state.fidelity.lod_neighbor_threshold = header.lod_neighbor_threshold;
+  state.fidelity.far_field_neighbor_threshold =
+      header.far_field_neighbor_threshold;
+
+  const uint8_t *record_data = file.data() + sizeof(header);
+  boids.clear();
+  boids.reserve(header.num_boids);
+
+  for (size_t i = 0; i < header.num_boids; i++) {
+    BoidRecord record;
+    std::memcpy(&record, record_data + i * sizeof(BoidRecord),
+                sizeof(BoidRecord));
+    boids.push_back(FromRecord(record));
+  }
+
+  const uint8_t *count_data =
+      record_data + header.num_boids * sizeof(BoidRecord);
+  neighbor_counts.resize(header.num_neighbor_counts);
+
+  for (size_t i = 0; i < header.num_neighbor_counts; i++) {
+    uint64_t count;
+    std::memcpy(&count, count_data + i * sizeof(uint64_t), sizeof(uint64_t));
+    neighbor_counts[i] = count;
+  }
+}
+
+} // namespace boid_sim
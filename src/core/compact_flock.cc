@@ -0,0 +1,402 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "core/compact_flock.h"
+#include "core/parallel_for.h"
+
+namespace boid_sim {
+
+namespace {
+
+const double kMinCells = 1 << 16;
+const double kMaxCellsPerBoid = 64.0;
+
+// Steps a cell is split into along every axis, and steps of max_speed
+const float kOffsetSteps = 65536.0f;
+const float kVelocitySteps = 32767.0f;
+
+} // namespace
+
+template <int Dim>
+CompactFlock<Dim>::CompactFlock(
+    const std::vector<std::vector<float>> &container_bounds,
+    const std::vector<BasicBoid<Dim>> &boids,
+    const FlockingParams &flocking_params)
+    : container_bounds_(container_bounds), flocking_params_(flocking_params),
+      max_speed_(flocking_params.max_speed),
+      fov_radius_(flocking_params.fov_radius) {
+  if (container_bounds.size() != (size_t)Dim) {
+    throw std::invalid_argument("CompactFlock needs a bounded world!");
+  }
+
+  if (!boids.empty()) {
+    max_speed_ = boids.front().max_speed();
+    fov_radius_ = boids.front().fov_radius();
+  }
+
+  for (const BasicBoid<Dim> &boid : boids) {
+    if (boid.max_speed() != max_speed_ || boid.fov_radius() != fov_radius_) {
+      throw std::invalid_argument(
+          "Every boid in a CompactFlock needs the same speed and vision!");
+    }
+  }
+
+  if (!(max_speed_ > 0.0f) || !(fov_radius_ > 0.0f)) {
+    throw std::invalid_argument(
+        "CompactFlock needs a positive max speed and FOV radius!");
+  }
+
+  /*
+   * Cells are at least as big as a boid's vision, so the cells around a
+   * boid's own hold all of its neighbors. Like BasicSpatialGrid, cells grow
+   * when a spread out swarm would need too many.
+   */
+  double max_cells = std::max<double>(kMinCells,
+                                      kMaxCellsPerBoid * (double)boids.size());
+  cell_size_ = fov_radius_;
+
+  while (true) {
+    double cells = 1.0;
+    for (int axis = 0; axis < Dim; axis++) {
+      float extent = container_bounds[axis][1] - container_bounds[axis][0];
+      cells *= std::ceil(std::max(0.0f, extent) / cell_size_) + 2.0;
+    }
+
+    if (!(cells > max_cells)) {
+      break;
+    }
+
+    cell_size_ *= 2.0f;
+  }
+
+  // One ring of cells around the container holds boids that stray outside
+  size_t num_cells = 1;
+  for (int axis = 0; axis < Dim; axis++) {
+    float extent = container_bounds[axis][1] - container_bounds[axis][0];
+    origin_[axis] = container_bounds[axis][0] - cell_size_;
+    cells_along_[axis] =
+        (size_t)std::ceil(std::max(0.0f, extent) / cell_size_) + 2;
+    strides_[axis] = num_cells;
+    num_cells *= cells_along_[axis];
+  }
+
+  cell_starts_.assign(num_cells + 1, 0);
+  position_step_ = cell_size_ / kOffsetSteps;
+  velocity_step_ = max_speed_ / kVelocitySteps;
+
+  updated_.resize(boids.size());
+  updated_cells_.resize(boids.size());
+  ids_.resize(boids.size());
+
+  for (size_t i = 0; i < boids.size(); i++) {
+    size_t cell = CellOf(boids[i].position());
+    updated_cells_[i] = (uint32_t)cell;
+    updated_[i] = Encode(boids[i].position(), boids[i].velocity(), cell);
+    ids_[i] = (uint32_t)boids[i].id();
+  }
+
+  SortUpdated();
+}
+
+template <int Dim> void CompactFlock<Dim>::AdvanceOnFrame() {
+  // state_ is this frame's snapshot, and every boid writes only its own slot
+  // of updated_
+  ParallelFor(0, cell_starts_.size() - 1, num_threads_,
+              [&](size_t begin, size_t end) {
+                for (size_t cell = begin; cell < end; cell++) {
+                  for (size_t index = cell_starts_[cell];
+                       index < cell_starts_[cell + 1]; index++) {
+                    UpdateBoid(index, cell);
+                  }
+                }
+              });
+
+  SortUpdated();
+}
+
+template <int Dim>
+void CompactFlock<Dim>::set_num_threads(size_t num_threads) {
+  num_threads_ = std::max<size_t>(1, num_threads);
+}
+
+template <int Dim> size_t CompactFlock<Dim>::num_threads() const {
+  return num_threads_;
+}
+
+template <int Dim>
+std::vector<BasicBoid<Dim>> CompactFlock<Dim>::boids() const {
+  std::vector<BasicBoid<Dim>> boids;
+  boids.reserve(state_.size());
+
+  for (size_t cell = 0; cell + 1 < cell_starts_.size(); cell++) {
+    Vector origin = CellOrigin(cell);
+
+    for (size_t index = cell_starts_[cell]; index < cell_starts_[cell + 1];
+         index++) {
+      Vector velocity = DecodeVelocity(state_[index]);
+      BasicBoid<Dim> boid((int)ids_[index],
+                          DecodePosition(state_[index], origin), velocity,
+                          max_speed_, fov_radius_);
+      boid.set_velocity(velocity);
+      boids.push_back(boid);
+    }
+  }
+
+  std::sort(boids.begin(), boids.end(),
+            [](const BasicBoid<Dim> &boid1, const BasicBoid<Dim> &boid2) {
+              return boid1.id() < boid2.id();
+            });
+
+  return boids;
+}
+
+template <int Dim> size_t CompactFlock<Dim>::size() const {
+  return state_.size();
+}
+
+template <int Dim>
+typename CompactFlock<Dim>::Vector CompactFlock<Dim>::mean_position() const {
+  Vector mean(0.0f);
+  if (state_.empty()) {
+    return mean;
+  }
+
+  // The offsets are one pass straight through the stored boids
+  uint64_t offsets[Dim] = {};
+  for (const PackedBoid &boid : state_) {
+    for (int axis = 0; axis < Dim; axis++) {
+      offsets[axis] += boid.offset[axis];
+    }
+  }
+
+  // And how many cells from the origin the boids are comes from the counts
+  double cell_steps[Dim] = {};
+  size_t coordinate[Dim] = {};
+  for (size_t cell = 0; cell + 1 < cell_starts_.size(); cell++) {
+    double count = (double)(cell_starts_[cell + 1] - cell_starts_[cell]);
+    for (int axis = 0; axis < Dim; axis++) {
+      cell_steps[axis] += count * (double)coordinate[axis];
+    }
+
+    for (int axis = 0; axis < Dim && ++coordinate[axis] == cells_along_[axis];
+         axis++) {
+      coordinate[axis] = 0;
+    }
+  }
+
+  double num_boids = (double)state_.size();
+  for (int axis = 0; axis < Dim; axis++) {
+    mean[axis] = (float)(origin_[axis] +
+                         cell_steps[axis] / num_boids * cell_size_ +
+                         ((double)offsets[axis] / num_boids + 0.5) *
+                             position_step_);
+  }
+
+  return mean;
+}
+
+template <int Dim> float CompactFlock<Dim>::position_error_bound() const {
+  // Half a step, plus the rounding of a float as big as the furthest cell
+  // corner when the offset is added to it
+  float max_coordinate = 0.0f;
+  for (int axis = 0; axis < Dim; axis++) {
+    float far_corner = origin_[axis] + (float)cells_along_[axis] * cell_size_;
+    max_coordinate = std::max(max_coordinate, std::abs(origin_[axis]));
+    max_coordinate = std::max(max_coordinate, std::abs(far_corner));
+  }
+
+  float ulp = std::nextafter(max_coordinate,
+                             std::numeric_limits<float>::infinity()) -
+              max_coordinate;
+
+  return 0.5f * position_step_ + 2.0f * ulp;
+}
+
+template <int Dim> float CompactFlock<Dim>::velocity_error_bound() const {
+  return 0.5f * velocity_step_ +
+         max_speed_ * 4.0f * std::numeric_limits<float>::epsilon();
+}
+
+template <int Dim> size_t CompactFlock<Dim>::bytes_per_boid() {
+  return sizeof(PackedBoid) + sizeof(uint32_t);
+}
+
+template <int Dim> float CompactFlock<Dim>::cell_size() const {
+  return cell_size_;
+}
+
+template <int Dim>
+size_t CompactFlock<Dim>::CellOf(const Vector &position) const {
+  size_t cell = 0;
+
+  for (int axis = 0; axis < Dim; axis++) {
+    float coordinate =
+        std::floor((position[axis] - origin_[axis]) / cell_size_);
+    coordinate = std::min(std::max(coordinate, 0.0f),
+                          (float)(cells_along_[axis] - 1));
+    cell += (size_t)coordinate * strides_[axis];
+  }
+
+  return cell;
+}
+
+template <int Dim>
+typename CompactFlock<Dim>::Vector
+CompactFlock<Dim>::CellOrigin(size_t cell) const {
+  Vector origin = origin_;
+
+  for (int axis = 0; axis < Dim; axis++) {
+    size_t coordinate = cell / strides_[axis] % cells_along_[axis];
+    origin[axis] += (float)coordinate * cell_size_;
+  }
+
+  return origin;
+}
+
+template <int Dim>
+typename CompactFlock<Dim>::PackedBoid
+CompactFlock<Dim>::Encode(const Vector &position, const Vector &velocity,
+                          size_t cell) const {
+  PackedBoid packed;
+  Vector origin = CellOrigin(cell);
+
+  for (int axis = 0; axis < Dim; axis++) {
+    // Clamping only bites for boids beyond the ring around the container
+    float offset =
+        std::floor((position[axis] - origin[axis]) / position_step_);
+    packed.offset[axis] =
+        (uint16_t)std::min(std::max(offset, 0.0f), kOffsetSteps - 1.0f);
+
+    float speed = std::round(velocity[axis] / velocity_step_);
+    packed.velocity[axis] =
+        (int16_t)std::min(std::max(speed, -kVelocitySteps), kVelocitySteps);
+  }
+
+  return packed;
+}
+
+template <int Dim>
+typename CompactFlock<Dim>::Vector
+CompactFlock<Dim>::DecodePosition(const PackedBoid &boid,
+                                  const Vector &origin) const {
+  // The middle of the step, so the error is at most half a step either way
+  Vector position = origin;
+  for (int axis = 0; axis < Dim; axis++) {
+    position[axis] += ((float)boid.offset[axis] + 0.5f) * position_step_;
+  }
+
+  return position;
+}
+
+template <int Dim>
+typename CompactFlock<Dim>::Vector
+CompactFlock<Dim>::DecodeVelocity(const PackedBoid &boid) const {
+  Vector velocity(0.0f);
+  for (int axis = 0; axis < Dim; axis++) {
+    velocity[axis] = (float)boid.velocity[axis] * velocity_step_;
+  }
+
+  return velocity;
+}
+
+template <int Dim>
+void CompactFlock<Dim>::UpdateBoid(size_t index, size_t cell) {
+  Vector position = DecodePosition(state_[index], CellOrigin(cell));
+  Vector velocity = DecodeVelocity(state_[index]);
+
+  BasicBoid<Dim> boid((int)ids_[index], position, velocity, max_speed_,
+                      fov_radius_);
+  boid.set_velocity(velocity);
+  typename BasicBoid<Dim>::NeighborSums sums;
+
+  // Walk the block of cells around the boid's own, first axis fastest
+  size_t min_coordinate[Dim];
+  size_t max_coordinate[Dim];
+  size_t neighbor[Dim];
+
+  for (int axis = 0; axis < Dim; axis++) {
+    size_t coordinate = cell / strides_[axis] % cells_along_[axis];
+    min_coordinate[axis] = coordinate > 0 ? coordinate - 1 : 0;
+    max_coordinate[axis] = std::min(coordinate + 1, cells_along_[axis] - 1);
+    neighbor[axis] = min_coordinate[axis];
+  }
+
+  while (true) {
+    size_t neighbor_cell = 0;
+    Vector neighbor_origin = origin_;
+
+    for (int axis = 0; axis < Dim; axis++) {
+      neighbor_cell += neighbor[axis] * strides_[axis];
+      neighbor_origin[axis] += (float)neighbor[axis] * cell_size_;
+    }
+
+    for (size_t other = cell_starts_[neighbor_cell];
+         other < cell_starts_[neighbor_cell + 1]; other++) {
+      if (other == index) {
+        continue;
+      }
+
+      // Decoded into registers, never written back
+      Vector other_position = DecodePosition(state_[other], neighbor_origin);
+      if (glm::distance(position, other_position) < fov_radius_) {
+        boid.AddNeighbor(other_position, DecodeVelocity(state_[other]), sums);
+      }
+    }
+
+    int axis = 0;
+    while (axis < Dim && neighbor[axis] == max_coordinate[axis]) {
+      neighbor[axis] = min_coordinate[axis];
+      axis++;
+    }
+
+    if (axis == Dim) {
+      break;
+    }
+
+    neighbor[axis]++;
+  }
+
+  boid.UpdatePosition(container_bounds_, sums, flocking_params_.align_percent,
+                      flocking_params_.cohesion_percent,
+                      flocking_params_.separation_percent);
+
+  size_t new_cell = CellOf(boid.position());
+  updated_cells_[index] = (uint32_t)new_cell;
+  updated_[index] = Encode(boid.position(), boid.velocity(), new_cell);
+}
+
+template <int Dim> void CompactFlock<Dim>::SortUpdated() {
+  // Counting sort by cell, which keeps the order of boids within a cell
+  size_t num_cells = cell_starts_.size() - 1;
+  std::fill(cell_starts_.begin(), cell_starts_.end(), 0);
+
+  for (uint32_t cell : updated_cells_) {
+    cell_starts_[cell + 1]++;
+  }
+
+  for (size_t cell = 0; cell < num_cells; cell++) {
+    cell_starts_[cell + 1] += cell_starts_[cell];
+  }
+
+  cursors_.assign(cell_starts_.begin(), cell_starts_.end() - 1);
+  state_.resize(updated_.size());
+  sorted_ids_.resize(updated_.size());
+
+  for (size_t i = 0; i < updated_.size(); i++) {
+    uint32_t slot = cursors_[updated_cells_[i]]++;
+    state_[slot] = updated_[i];
+    sorted_ids_[slot] = ids_[i];
+  }
+
+  ids_.swap(sorted_ids_);
+}
+
+template class CompactFlock<2>;
+template class CompactFlock<3>;
+
+} // namespace boid_sim
@@ -0,0 +1,501 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <ctime>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "core/decomposed_simulation.h"
+
+namespace boid_sim {
+
+#ifndef _WIN32
+/*
+ * Lives in memory shared with the worker processes and mirrors the phase
+ * members used by worker threads. The lock and conditions are process shared.
+ */
+struct TileProcessControl {
+  pthread_mutex_t lock;
+  pthread_cond_t phase_started;
+  pthread_cond_t phase_finished;
+  uint64_t phase;
+  int32_t phase_kind;
+  float mouse_pos[2];
+  uint64_t num_working;
+  int32_t stopping;
+  // Set by a worker whose phase threw
+  int32_t failed;
+  // Set once a worker has exited on its own. The conditions can no longer be
+  // used then, since glibc waits on the dead waiter forever.
+  int32_t worker_lost;
+};
+#endif
+
+namespace {
+
+bool CompareIds(const Boid &boid1, const Boid &boid2) {
+  return boid1.id() < boid2.id();
+}
+
+#ifndef _WIN32
+// How long the simulation and its workers wait on each other before checking
+// the other side is still alive
+const long kWorkerPollNanoseconds = 100000000;
+
+timespec PollDeadline() {
+  timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_nsec += kWorkerPollNanoseconds;
+
+  if (deadline.tv_nsec >= 1000000000) {
+    deadline.tv_sec++;
+    deadline.tv_nsec -= 1000000000;
+  }
+
+  return deadline;
+}
+
+bool AnyWorkerExited(const std::vector<int> &worker_pids) {
+  for (int pid : worker_pids) {
+    int status;
+    if (waitpid(pid, &status, WNOHANG) != 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+#endif
+
+} // namespace
+
+DecomposedSimulation::DecomposedSimulation(
+    const std::vector<std::vector<float>> &container_bounds,
+    const std::vector<Boid> &boids, size_t tiles_x, size_t tiles_y,
+    HaloTransport &transport, const FlockingParams &params)
+    : container_bounds_(container_bounds), params_(params),
+      layout_(container_bounds, tiles_x, tiles_y), transport_(transport),
+      halo_width_(0.0f) {
+  tiles_.resize(layout_.num_tiles());
+  neighborhoods_.resize(layout_.num_tiles());
+
+  // A tile is never sent more than every boid at once, whether as ghosts,
+  // migrants or a report
+  transport_.Open(layout_.num_tiles(), boids.size());
+
+  for (const Boid &boid : boids) {
+    tiles_[layout_.TileOf(boid.position())].push_back(boid);
+    halo_width_ = std::max(halo_width_, boid.fov_radius());
+  }
+
+  // Small margin so rounding on a tile edge can never drop a neighbor
+  halo_width_ *= 1.001f;
+
+  for (std::vector<Boid> &tile : tiles_) {
+    std::sort(tile.begin(), tile.end(), CompareIds);
+  }
+
+  if (transport_.reaches_other_processes()) {
+    StartWorkerProcesses();
+    return;
+  }
+
+  for (size_t tile = 0; tile < tiles_.size(); tile++) {
+    workers_.emplace_back(&DecomposedSimulation::WorkerLoop, this, tile);
+  }
+}
+
+DecomposedSimulation::~DecomposedSimulation() {
+  if (process_control_ != nullptr) {
+    StopWorkerProcesses();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(phase_lock_);
+    stopping_ = true;
+  }
+
+  phase_started_.notify_all();
+
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+void DecomposedSimulation::AdvanceOnFrame(glm::vec2 &mouse_pos) {
+  /*
+   * Every phase runs on all tiles before the next one starts, so a mailbox
+   * only ever holds ghosts or migrants, never both.
+   */
+  RunOnEachTile(TilePhase::kSendGhosts, mouse_pos);
+  RunOnEachTile(TilePhase::kUpdate, mouse_pos);
+  RunOnEachTile(TilePhase::kSendMigrants, mouse_pos);
+  RunOnEachTile(TilePhase::kReceiveMigrants, mouse_pos);
+
+  tiles_stale_ = process_control_ != nullptr;
+}
+
+std::vector<Boid> DecomposedSimulation::boids() const {
+  CollectTiles();
+  std::vector<Boid> all_boids;
+
+  for (const std::vector<Boid> &tile : tiles_) {
+    all_boids.insert(all_boids.end(), tile.begin(), tile.end());
+  }
+
+  std::sort(all_boids.begin(), all_boids.end(), CompareIds);
+
+  return all_boids;
+}
+
+const std::vector<Boid> &DecomposedSimulation::tile_boids(size_t tile) const {
+  CollectTiles();
+  return tiles_.at(tile);
+}
+
+const TileLayout &DecomposedSimulation::layout() const { return layout_; }
+
+bool DecomposedSimulation::uses_worker_processes() const {
+  return process_control_ != nullptr;
+}
+
+void DecomposedSimulation::StartWorkerProcesses() {
+#ifndef _WIN32
+  void *mapping = mmap(nullptr, sizeof(TileProcessControl),
+                       PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS,
+                       -1, 0);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Could not map tile worker control");
+  }
+
+  process_control_ = new (mapping) TileProcessControl();
+
+  pthread_mutexattr_t lock_attributes;
+  pthread_mutexattr_init(&lock_attributes);
+  pthread_mutexattr_setpshared(&lock_attributes, PTHREAD_PROCESS_SHARED);
+  pthread_mutex_init(&process_control_->lock, &lock_attributes);
+  pthread_mutexattr_destroy(&lock_attributes);
+
+  pthread_condattr_t condition_attributes;
+  pthread_condattr_init(&condition_attributes);
+  pthread_condattr_setpshared(&condition_attributes, PTHREAD_PROCESS_SHARED);
+  pthread_cond_init(&process_control_->phase_started, &condition_attributes);
+  pthread_cond_init(&process_control_->phase_finished, &condition_attributes);
+  pthread_condattr_destroy(&condition_attributes);
+
+  pid_t parent = getpid();
+
+  for (size_t tile = 0; tile < tiles_.size(); tile++) {
+    pid_t pid = fork();
+
+    if (pid < 0) {
+      StopWorkerProcesses();
+      throw std::runtime_error("Could not start a tile worker process");
+    }
+
+    if (pid == 0) {
+      // Never returns, so the worker does not run the rest of its copy of
+      // the parent, like static destructors or a test runner
+      ProcessLoop(tile, parent);
+    }
+
+    worker_pids_.push_back(pid);
+  }
+#else
+  throw std::runtime_error("Tile worker processes need POSIX");
+#endif
+}
+
+void DecomposedSimulation::StopWorkerProcesses() {
+#ifndef _WIN32
+  pthread_mutex_lock(&process_control_->lock);
+  bool worker_lost = process_control_->worker_lost != 0;
+  process_control_->stopping = 1;
+
+  if (!worker_lost) {
+    pthread_cond_broadcast(&process_control_->phase_started);
+  }
+  pthread_mutex_unlock(&process_control_->lock);
+
+  for (int pid : worker_pids_) {
+    if (worker_lost) {
+      kill(pid, SIGKILL);
+    }
+
+    waitpid(pid, nullptr, 0);
+  }
+
+  worker_pids_.clear();
+
+  // The lock and conditions go with the mapping. Destroying a condition
+  // waits for its waiters to leave, which one that was killed never does.
+  munmap(process_control_, sizeof(TileProcessControl));
+  process_control_ = nullptr;
+#endif
+}
+
+void DecomposedSimulation::RunOnEachTile(TilePhase phase,
+                                         const glm::vec2 &mouse_pos) {
+  if (process_control_ != nullptr) {
+    RunOnEachProcess(phase, mouse_pos);
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(phase_lock_);
+  phase_kind_ = phase;
+  phase_mouse_pos_ = mouse_pos;
+  num_working_ = workers_.size();
+  phase_++;
+  phase_started_.notify_all();
+
+  phase_finished_.wait(lock, [this] { return num_working_ == 0; });
+}
+
+void DecomposedSimulation::RunOnEachProcess(
+    TilePhase phase, const glm::vec2 &mouse_pos) const {
+#ifndef _WIN32
+  TileProcessControl &control = *process_control_;
+
+  pthread_mutex_lock(&control.lock);
+  if (control.worker_lost) {
+    pthread_mutex_unlock(&control.lock);
+    throw std::runtime_error("A tile worker process exited");
+  }
+
+  control.phase_kind = (int32_t)phase;
+  control.mouse_pos[0] = mouse_pos.x;
+  control.mouse_pos[1] = mouse_pos.y;
+  control.num_working = worker_pids_.size();
+  control.failed = 0;
+  control.phase++;
+  pthread_cond_broadcast(&control.phase_started);
+
+  // A worker that died would never finish the phase, so the wait gives up
+  // once one has exited
+  while (control.num_working != 0) {
+    timespec deadline = PollDeadline();
+
+    if (pthread_cond_timedwait(&control.phase_finished, &control.lock,
+                               &deadline) == ETIMEDOUT &&
+        AnyWorkerExited(worker_pids_)) {
+      control.worker_lost = 1;
+      pthread_mutex_unlock(&control.lock);
+      throw std::runtime_error("A tile worker process exited");
+    }
+  }
+
+  bool failed = control.failed != 0;
+  pthread_mutex_unlock(&control.lock);
+
+  if (failed) {
+    throw std::runtime_error("A tile worker process failed a phase");
+  }
+#else
+  (void)phase;
+  (void)mouse_pos;
+#endif
+}
+
+void DecomposedSimulation::WorkerLoop(size_t tile) {
+  size_t last_phase = 0;
+
+  while (true) {
+    TilePhase phase;
+    glm::vec2 mouse_pos;
+
+    {
+      std::unique_lock<std::mutex> lock(phase_lock_);
+      phase_started_.wait(
+          lock, [&] { return stopping_ || phase_ != last_phase; });
+
+      if (stopping_) {
+        return;
+      }
+
+      last_phase = phase_;
+      phase = phase_kind_;
+      mouse_pos = phase_mouse_pos_;
+    }
+
+    RunTilePhase(phase, tile, mouse_pos);
+
+    std::lock_guard<std::mutex> guard(phase_lock_);
+    if (--num_working_ == 0) {
+      phase_finished_.notify_one();
+    }
+  }
+}
+
+void DecomposedSimulation::ProcessLoop(size_t tile, int parent) {
+#ifndef _WIN32
+  TileProcessControl &control = *process_control_;
+  uint64_t last_phase = 0;
+
+  while (true) {
+    pthread_mutex_lock(&control.lock);
+    while (!control.stopping && control.phase == last_phase) {
+      timespec deadline = PollDeadline();
+
+      // Nobody is left to stop the worker if the simulation went away
+      if (pthread_cond_timedwait(&control.phase_started, &control.lock,
+                                 &deadline) == ETIMEDOUT &&
+          getppid() != parent) {
+        pthread_mutex_unlock(&control.lock);
+        _exit(1);
+      }
+    }
+
+    if (control.stopping) {
+      pthread_mutex_unlock(&control.lock);
+      break;
+    }
+
+    last_phase = control.phase;
+    TilePhase phase = (TilePhase)control.phase_kind;
+    glm::vec2 mouse_pos(control.mouse_pos[0], control.mouse_pos[1]);
+    pthread_mutex_unlock(&control.lock);
+
+    // Nothing may be thrown past here, it would unwind into the parent's code
+    bool failed = false;
+    try {
+      RunTilePhase(phase, tile, mouse_pos);
+    } catch (...) {
+      failed = true;
+    }
+
+    pthread_mutex_lock(&control.lock);
+    if (failed) {
+      control.failed = 1;
+    }
+
+    if (--control.num_working == 0) {
+      pthread_cond_signal(&control.phase_finished);
+    }
+    pthread_mutex_unlock(&control.lock);
+  }
+
+  _exit(0);
+#else
+  (void)tile;
+  (void)parent;
+#endif
+}
+
+void DecomposedSimulation::CollectTiles() const {
+  if (!tiles_stale_) {
+    return;
+  }
+
+  RunOnEachProcess(TilePhase::kReport, glm::vec2(0, 0));
+
+  for (size_t tile = 0; tile < tiles_.size(); tile++) {
+    tiles_[tile].clear();
+    transport_.Receive(tile, tiles_[tile]);
+  }
+
+  tiles_stale_ = false;
+}
+
+void DecomposedSimulation::RunTilePhase(TilePhase phase, size_t tile,
+                                        glm::vec2 mouse_pos) {
+  switch (phase) {
+  case TilePhase::kSendGhosts:
+    SendGhosts(tile);
+    break;
+  case TilePhase::kUpdate:
+    UpdateTile(tile, mouse_pos);
+    break;
+  case TilePhase::kSendMigrants:
+    SendMigrants(tile);
+    break;
+  case TilePhase::kReceiveMigrants:
+    ReceiveMigrants(tile);
+    break;
+  case TilePhase::kReport:
+    // Tiles stay sorted by id, so the report needs no sorting either
+    transport_.Send(tile, tiles_[tile]);
+    break;
+  }
+}
+
+void DecomposedSimulation::SendGhosts(size_t tile) {
+  std::vector<std::vector<Boid>> ghosts(tiles_.size());
+  std::vector<size_t> nearby_tiles;
+
+  for (const Boid &boid : tiles_[tile]) {
+    layout_.TilesWithin(boid.position(), halo_width_, nearby_tiles);
+
+    for (size_t nearby_tile : nearby_tiles) {
+      ghosts[nearby_tile].push_back(boid);
+    }
+  }
+
+  for (size_t dest_tile = 0; dest_tile < ghosts.size(); dest_tile++) {
+    if (!ghosts[dest_tile].empty()) {
+      transport_.Send(dest_tile, ghosts[dest_tile]);
+    }
+  }
+}
+
+void DecomposedSimulation::UpdateTile(size_t tile, glm::vec2 &mouse_pos) {
+  /*
+   * Owned boids and ghosts are put in id order so each boid sums up its
+   * neighbors in the same order as the single process path does.
+   */
+  std::vector<Boid> &neighborhood = neighborhoods_[tile];
+  neighborhood = tiles_[tile];
+  transport_.Receive(tile, neighborhood);
+  std::sort(neighborhood.begin(), neighborhood.end(), CompareIds);
+
+  for (Boid &boid : tiles_[tile]) {
+    boid.UpdatePosition(container_bounds_, neighborhood, mouse_pos,
+                        params_.align_percent, params_.cohesion_percent,
+                        params_.separation_percent);
+  }
+}
+
+void DecomposedSimulation::SendMigrants(size_t tile) {
+  std::vector<std::vector<Boid>> migrants(tiles_.size());
+  std::vector<Boid> staying;
+
+  for (const Boid &boid : tiles_[tile]) {
+    size_t owner = layout_.TileOf(boid.position());
+
+    if (owner == tile) {
+      staying.push_back(boid);
+    } else {
+      migrants[owner].push_back(boid);
+    }
+  }
+
+  for (size_t dest_tile = 0; dest_tile < migrants.size(); dest_tile++) {
+    if (!migrants[dest_tile].empty()) {
+      transport_.Send(dest_tile, migrants[dest_tile]);
+    }
+  }
+
+  tiles_[tile].swap(staying);
+}
+
+void DecomposedSimulation::ReceiveMigrants(size_t tile) {
+  std::vector<Boid> &owned = tiles_[tile];
+  size_t num_staying = owned.size();
+  transport_.Receive(tile, owned);
+
+  if (owned.size() > num_staying) {
+    std::sort(owned.begin(), owned.end(), CompareIds);
+  }
+}
+
+} // namespace boid_sim
@@ -0,0 +1,207 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+
+#include "core/flock_analytics.h"
+#include "core/parallel_for.h"
+
+namespace boid_sim {
+
+namespace {
+
+/*
+ * Reductions are summed in chunks of a fixed size, and the chunks in order,
+ * so the totals come out the same for any thread count.
+ */
+const size_t kReductionChunkSize = 4096;
+
+const size_t kMinFlockSize = 2;
+
+} // namespace
+
+FlockAnalytics::FlockAnalytics(size_t density_columns, size_t density_rows,
+                               size_t buffer_capacity)
+    : buffer_(buffer_capacity), parents_size_(0), num_boids_(0) {
+  latest_.density_columns = std::max<size_t>(1, density_columns);
+  latest_.density_rows = std::max<size_t>(1, density_rows);
+  latest_.density.assign(latest_.density_columns * latest_.density_rows,
+                         0.0f);
+}
+
+void FlockAnalytics::BeginFrame(size_t num_boids) {
+  if (parents_size_ < num_boids) {
+    parents_.reset(new std::atomic<uint32_t>[num_boids]);
+    parents_size_ = num_boids;
+  }
+
+  for (size_t i = 0; i < num_boids; i++) {
+    parents_[i].store((uint32_t)i, std::memory_order_relaxed);
+  }
+
+  num_boids_ = num_boids;
+}
+
+void FlockAnalytics::Link(size_t boid, const std::vector<size_t> &visible) {
+  /*
+   * Lock free union: the root with the larger index is always hung under the
+   * smaller one, so every flock ends up rooted at its lowest index no matter
+   * which thread links what first. Parent pointers only ever move to another
+   * ancestor, so relaxed ordering is enough.
+   */
+  size_t root = FindRoot(boid);
+
+  for (size_t other : visible) {
+    // Vision cones, neighbor caps, far field sampling and coasting boids all
+    // leave pairs seen from one side only, so every pair given is linked
+    if (parents_[other].load(std::memory_order_relaxed) == root) {
+      continue;
+    }
+
+    size_t other_root = FindRoot(other);
+
+    while (root != other_root) {
+      size_t high = std::max(root, other_root);
+      uint32_t low = (uint32_t)std::min(root, other_root);
+      uint32_t expected = (uint32_t)high;
+
+      if (parents_[high].compare_exchange_weak(expected, low,
+                                               std::memory_order_relaxed)) {
+        break;
+      }
+
+      root = FindRoot(root);
+      other_root = FindRoot(other_root);
+    }
+
+    root = FindRoot(root);
+  }
+}
+
+void FlockAnalytics::SetFrameBudget(double step_ms, size_t quality_level,
+                                    const FidelitySettings &fidelity) {
+  latest_.step_ms = step_ms;
+  latest_.quality_level = quality_level;
+  latest_.fidelity = fidelity;
+}
+
+void FlockAnalytics::EndFrame(
+    size_t frame, BoidSpan boids,
+    const std::vector<size_t> &neighbor_counts,
+    const std::vector<std::vector<float>> &container_bounds,
+    size_t num_threads) {
+  latest_.frame = frame;
+
+  CountFlocks();
+  SumChunks(boids, neighbor_counts, num_threads);
+  SplatDensity(boids, container_bounds);
+
+  buffer_.Push(latest_);
+}
+
+RingBuffer<FrameAnalytics> &FlockAnalytics::buffer() { return buffer_; }
+
+const FrameAnalytics &FlockAnalytics::latest() const { return latest_; }
+
+size_t FlockAnalytics::FindRoot(size_t boid) {
+  size_t parent = parents_[boid].load(std::memory_order_relaxed);
+
+  while (parent != boid) {
+    // Path halving: point the boid at its grandparent on the way up
+    uint32_t grandparent = parents_[parent].load(std::memory_order_relaxed);
+    if (grandparent != parent) {
+      parents_[boid].store(grandparent, std::memory_order_relaxed);
+    }
+
+    boid = grandparent;
+    parent = parents_[boid].load(std::memory_order_relaxed);
+  }
+
+  return boid;
+}
+
+void FlockAnalytics::CountFlocks() {
+  flock_sizes_.assign(num_boids_, 0);
+
+  for (size_t i = 0; i < num_boids_; i++) {
+    flock_sizes_[FindRoot(i)]++;
+  }
+
+  latest_.num_flocks = 0;
+  latest_.largest_flock = 0;
+
+  for (size_t size : flock_sizes_) {
+    if (size >= kMinFlockSize) {
+      latest_.num_flocks++;
+      latest_.largest_flock = std::max(latest_.largest_flock, size);
+    }
+  }
+}
+
+void FlockAnalytics::SumChunks(BoidSpan boids,
+                               const std::vector<size_t> &neighbor_counts,
+                               size_t num_threads) {
+  size_t num_chunks =
+      (boids.size() + kReductionChunkSize - 1) / kReductionChunkSize;
+  chunk_headings_.assign(num_chunks, glm::vec2(0, 0));
+  chunk_speeds_.assign(num_chunks, 0.0f);
+  chunk_neighbors_.assign(num_chunks, 0);
+
+  ParallelFor(0, num_chunks, num_threads, [&](size_t begin, size_t end) {
+    for (size_t chunk = begin; chunk < end; chunk++) {
+      size_t first = chunk * kReductionChunkSize;
+      size_t last = std::min(boids.size(), first + kReductionChunkSize);
+
+      for (size_t i = first; i < last; i++) {
+        float speed = glm::length(boids[i].velocity());
+        chunk_speeds_[chunk] += speed;
+        chunk_neighbors_[chunk] += neighbor_counts[i];
+
+        if (speed > 0.0f) {
+          chunk_headings_[chunk] += boids[i].velocity() / speed;
+        }
+      }
+    }
+  });
+
+  glm::vec2 heading_sum(0, 0);
+  float speed_sum = 0.0f;
+  size_t neighbor_sum = 0;
+
+  for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+    heading_sum += chunk_headings_[chunk];
+    speed_sum += chunk_speeds_[chunk];
+    neighbor_sum += chunk_neighbors_[chunk];
+  }
+
+  float num_boids = std::max(1.0f, (float)boids.size());
+  latest_.polarization = glm::length(heading_sum) / num_boids;
+  latest_.mean_speed = speed_sum / num_boids;
+  latest_.mean_neighbors = neighbor_sum / num_boids;
+}
+
+void FlockAnalytics::SplatDensity(
+    BoidSpan boids,
+    const std::vector<std::vector<float>> &container_bounds) {
+  std::fill(latest_.density.begin(), latest_.density.end(), 0.0f);
+
+  float min_x = container_bounds[0][0];
+  float min_y = container_bounds[1][0];
+  float cell_width = (container_bounds[0][1] - min_x) / latest_.density_columns;
+  float cell_height = (container_bounds[1][1] - min_y) / latest_.density_rows;
+
+  for (const Boid &boid : boids) {
+    float column = std::floor((boid.position().x - min_x) / cell_width);
+    float row = std::floor((boid.position().y - min_y) / cell_height);
+
+    // Boids outside of the container are left off of the map
+    if (column >= 0.0f && column < latest_.density_columns && row >= 0.0f &&
+        row < latest_.density_rows) {
+      latest_.density[(size_t)row * latest_.density_columns + (size_t)column] +=
+          1.0f;
+    }
+  }
+}
+
+} // namespace boid_sim
@@ -0,0 +1,74 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cstdint>
+
+#include "core/frame_arena.h"
+
+namespace boid_sim {
+
+FrameArena::FrameArena(size_t initial_capacity)
+    : initial_capacity_(std::max<size_t>(1, initial_capacity)) {}
+
+void *FrameArena::Allocate(size_t bytes, size_t alignment) {
+  while (true) {
+    if (current_block_ < blocks_.size()) {
+      Block &block = blocks_[current_block_];
+      uintptr_t base = reinterpret_cast<uintptr_t>(block.memory.get());
+      size_t start =
+          (size_t)(((base + offset_ + alignment - 1) & ~(alignment - 1)) -
+                   base);
+
+      if (start + bytes <= block.size) {
+        used_bytes_ += start + bytes - offset_;
+        high_water_mark_ = std::max(high_water_mark_, used_bytes_);
+        offset_ = start + bytes;
+
+        return block.memory.get() + start;
+      }
+
+      // What is left of this block is too small, so move on to the next
+      used_bytes_ += block.size - offset_;
+      current_block_++;
+      offset_ = 0;
+    }
+
+    if (current_block_ == blocks_.size()) {
+      AddBlock(bytes + alignment);
+    }
+  }
+}
+
+void FrameArena::Reset() {
+  if (blocks_.size() > 1) {
+    // The frame needed more than one block, so the next gets it in one piece
+    size_t size = capacity_;
+    blocks_.clear();
+    capacity_ = 0;
+    AddBlock(size);
+  }
+
+  current_block_ = 0;
+  offset_ = 0;
+  used_bytes_ = 0;
+}
+
+size_t FrameArena::used_bytes() const { return used_bytes_; }
+
+size_t FrameArena::high_water_mark() const { return high_water_mark_; }
+
+size_t FrameArena::capacity() const { return capacity_; }
+
+void FrameArena::AddBlock(size_t min_size) {
+  // Doubling keeps the number of blocks a growing frame needs logarithmic
+  size_t size = std::max(min_size, std::max(initial_capacity_, capacity_));
+
+  Block block;
+  block.memory.reset(new char[size]);
+  block.size = size;
+  blocks_.push_back(std::move(block));
+  capacity_ += size;
+}
+
+} // namespace boid_sim
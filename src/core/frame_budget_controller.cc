@@ -0,0 +1,148 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <stdexcept>
+
+#include "core/frame_budget_controller.h"
+
+namespace boid_sim {
+
+namespace {
+
+/*
+ * Once there are no substeps left to drop, the far field is sampled first,
+ * as it changes the flock least, then dense boids start coasting, and only
+ * then is every boid's neighbor count capped.
+ */
+struct ReducedLevel {
+  size_t far_field_neighbor_threshold;
+  size_t lod_neighbor_threshold;
+  size_t max_neighbors;
+};
+
+const size_t kNone = std::numeric_limits<size_t>::max();
+
+const ReducedLevel kReducedLevels[] = {{64, kNone, kNone},
+                                       {32, 48, kNone},
+                                       {16, 24, 32},
+                                       {8, 12, 16},
+                                       {4, 6, 8}};
+
+const size_t kNumReducedLevels =
+    sizeof(kReducedLevels) / sizeof(kReducedLevels[0]);
+
+// Weight of the newest frame in the smoothed step time
+const double kSmoothing = 0.2;
+
+// Over budget for this many frames in a row drops a level
+const size_t kFramesToDegrade = 3;
+
+// Under this fraction of the budget for this many frames climbs a level
+const double kUpgradeRatio = 0.6;
+const size_t kFramesToUpgrade = 60;
+
+// Frames after a change before the effect of it is trusted
+const size_t kSettleFrames = 10;
+
+} // namespace
+
+const size_t FidelitySettings::kUnlimited = std::numeric_limits<size_t>::max();
+
+bool operator==(const FidelitySettings &settings1,
+                const FidelitySettings &settings2) {
+  return settings1.max_neighbors == settings2.max_neighbors &&
+         settings1.substeps == settings2.substeps &&
+         settings1.lod_neighbor_threshold == settings2.lod_neighbor_threshold &&
+         settings1.far_field_neighbor_threshold ==
+             settings2.far_field_neighbor_threshold;
+}
+
+bool operator!=(const FidelitySettings &settings1,
+                const FidelitySettings &settings2) {
+  return !(settings1 == settings2);
+}
+
+FrameBudgetController::FrameBudgetController(double target_ms,
+                                             size_t max_substeps)
+    : target_ms_(target_ms), max_substeps_(max_substeps) {
+  if (!(target_ms > 0.0)) {
+    throw std::invalid_argument("Target frame time must be positive!");
+  } else if (max_substeps == 0) {
+    throw std::invalid_argument("Frames need at least one substep!");
+  }
+
+  settings_ = SettingsForLevel(0);
+}
+
+const FidelitySettings &FrameBudgetController::Update(double step_ms) {
+  smoothed_ms_ = num_frames_ == 0
+                     ? step_ms
+                     : smoothed_ms_ + kSmoothing * (step_ms - smoothed_ms_);
+  num_frames_++;
+  frames_since_change_++;
+
+  frames_over_ = smoothed_ms_ > target_ms_ ? frames_over_ + 1 : 0;
+  frames_under_ =
+      smoothed_ms_ < target_ms_ * kUpgradeRatio ? frames_under_ + 1 : 0;
+
+  if (frames_since_change_ < kSettleFrames) {
+    return settings_;
+  }
+
+  if (frames_over_ >= kFramesToDegrade && level_ + 1 < num_levels()) {
+    SetLevel(level_ + 1);
+  } else if (frames_under_ >= kFramesToUpgrade && level_ > 0) {
+    SetLevel(level_ - 1);
+  }
+
+  return settings_;
+}
+
+FidelitySettings FrameBudgetController::SettingsForLevel(size_t level) const {
+  FidelitySettings settings;
+
+  if (level < max_substeps_) {
+    settings.substeps = max_substeps_ - level;
+    return settings;
+  }
+
+  const ReducedLevel &reduced =
+      kReducedLevels[std::min(level - max_substeps_, kNumReducedLevels - 1)];
+  settings.far_field_neighbor_threshold =
+      reduced.far_field_neighbor_threshold;
+  settings.lod_neighbor_threshold = reduced.lod_neighbor_threshold;
+  settings.max_neighbors = reduced.max_neighbors;
+
+  return settings;
+}
+
+const FidelitySettings &FrameBudgetController::settings() const {
+  return settings_;
+}
+
+size_t FrameBudgetController::level() const { return level_; }
+
+size_t FrameBudgetController::num_levels() const {
+  return max_substeps_ + kNumReducedLevels;
+}
+
+double FrameBudgetController::smoothed_ms() const { return smoothed_ms_; }
+
+double FrameBudgetController::target_ms() const { return target_ms_; }
+
+size_t FrameBudgetController::num_changes() const { return num_changes_; }
+
+void FrameBudgetController::SetLevel(size_t level) {
+  level_ = level;
+  settings_ = SettingsForLevel(level);
+  frames_over_ = 0;
+  frames_under_ = 0;
+  frames_since_change_ = 0;
+  num_changes_++;
+
+  // Frames stepped at the old level say nothing about the new one
+  num_frames_ = 0;
+}
+
+} // namespace boid_sim
@@ -0,0 +1,216 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+#include "core/boid_record.h"
+#include "core/halo_transport.h"
+
+namespace boid_sim {
+
+namespace {
+
+/*
+ * Head of one tile's mailbox in shared memory, followed on the next cache
+ * line by its records. num_records counts the records claimed by senders.
+ */
+struct SharedMailbox {
+  std::atomic<uint64_t> num_records;
+};
+
+const size_t kCacheLine = 64;
+
+size_t RoundUpToLine(size_t bytes) {
+  return (bytes + kCacheLine - 1) / kCacheLine * kCacheLine;
+}
+
+BoidRecord *RecordsOf(SharedMailbox *mailbox) {
+  return reinterpret_cast<BoidRecord *>(reinterpret_cast<uint8_t *>(mailbox) +
+                                        kCacheLine);
+}
+
+} // namespace
+
+void InProcessQueueTransport::Open(size_t num_tiles, size_t) {
+  mailboxes_.assign(num_tiles, std::vector<Boid>());
+  locks_.clear();
+
+  for (size_t i = 0; i < num_tiles; i++) {
+    locks_.emplace_back(new std::mutex());
+  }
+}
+
+void InProcessQueueTransport::Send(size_t dest_tile,
+                                   const std::vector<Boid> &boids) {
+  std::lock_guard<std::mutex> guard(*locks_.at(dest_tile));
+  std::vector<Boid> &mailbox = mailboxes_[dest_tile];
+  mailbox.insert(mailbox.end(), boids.begin(), boids.end());
+}
+
+void InProcessQueueTransport::Receive(size_t dest_tile,
+                                      std::vector<Boid> &boids) {
+  std::lock_guard<std::mutex> guard(*locks_.at(dest_tile));
+  std::vector<Boid> &mailbox = mailboxes_[dest_tile];
+  boids.insert(boids.end(), mailbox.begin(), mailbox.end());
+  mailbox.clear();
+}
+
+void LoopbackTransport::Open(size_t num_tiles, size_t) {
+  streams_.assign(num_tiles, std::vector<uint8_t>());
+  locks_.clear();
+
+  for (size_t i = 0; i < num_tiles; i++) {
+    locks_.emplace_back(new std::mutex());
+  }
+
+  bytes_sent_ = 0;
+}
+
+void LoopbackTransport::Send(size_t dest_tile,
+                             const std::vector<Boid> &boids) {
+  std::vector<uint8_t> packet(boids.size() * sizeof(BoidRecord));
+
+  for (size_t i = 0; i < boids.size(); i++) {
+    BoidRecord record = ToRecord(boids[i]);
+    std::memcpy(&packet[i * sizeof(BoidRecord)], &record, sizeof(BoidRecord));
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(*locks_.at(dest_tile));
+    std::vector<uint8_t> &stream = streams_[dest_tile];
+    stream.insert(stream.end(), packet.begin(), packet.end());
+  }
+
+  std::lock_guard<std::mutex> guard(bytes_lock_);
+  bytes_sent_ += packet.size();
+}
+
+void LoopbackTransport::Receive(size_t dest_tile, std::vector<Boid> &boids) {
+  std::vector<uint8_t> stream;
+
+  {
+    std::lock_guard<std::mutex> guard(*locks_.at(dest_tile));
+    stream.swap(streams_[dest_tile]);
+  }
+
+  for (size_t offset = 0; offset + sizeof(BoidRecord) <= stream.size();
+       offset += sizeof(BoidRecord)) {
+    BoidRecord record;
+    std::memcpy(&record, &stream[offset], sizeof(BoidRecord));
+    boids.push_back(FromRecord(record));
+  }
+}
+
+size_t LoopbackTransport::bytes_sent() const { return bytes_sent_; }
+
+SharedMemoryTransport::~SharedMemoryTransport() { Close(); }
+
+void SharedMemoryTransport::Open(size_t num_tiles, size_t max_boids) {
+  Close();
+
+  // Worker processes share the counters, which only works if they are plain
+  // memory rather than a lock kept by each process
+  std::atomic<uint64_t> counter(0);
+  if (!counter.is_lock_free()) {
+    throw std::runtime_error("Shared mailboxes need lock free 64-bit atomics");
+  }
+
+#ifndef _WIN32
+  mailbox_stride_ =
+      kCacheLine + RoundUpToLine(max_boids * sizeof(BoidRecord));
+  size_ = std::max<size_t>(num_tiles, 1) * mailbox_stride_;
+
+  void *mapping = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    size_ = 0;
+    throw std::runtime_error("Could not map shared mailboxes");
+  }
+
+  data_ = static_cast<uint8_t *>(mapping);
+  num_tiles_ = num_tiles;
+  capacity_ = max_boids;
+
+  for (size_t tile = 0; tile < num_tiles_; tile++) {
+    SharedMailbox *mailbox =
+        new (data_ + tile * mailbox_stride_) SharedMailbox();
+    mailbox->num_records.store(0, std::memory_order_relaxed);
+  }
+#else
+  (void)num_tiles;
+  (void)max_boids;
+  throw std::runtime_error("Shared mailboxes need POSIX shared memory");
+#endif
+}
+
+void SharedMemoryTransport::Send(size_t dest_tile,
+                                 const std::vector<Boid> &boids) {
+  if (dest_tile >= num_tiles_) {
+    throw std::out_of_range("No mailbox for tile " +
+                            std::to_string(dest_tile));
+  }
+
+  SharedMailbox *mailbox =
+      reinterpret_cast<SharedMailbox *>(data_ + dest_tile * mailbox_stride_);
+
+  // The receiver only reads once the phase is over, and whatever ends the
+  // phase also publishes the records, so claiming room can be relaxed
+  uint64_t start =
+      mailbox->num_records.fetch_add(boids.size(), std::memory_order_relaxed);
+  if (start + boids.size() > capacity_) {
+    throw std::runtime_error("Mailbox for tile " + std::to_string(dest_tile) +
+                             " is full");
+  }
+
+  BoidRecord *records = RecordsOf(mailbox) + start;
+  for (size_t i = 0; i < boids.size(); i++) {
+    records[i] = ToRecord(boids[i]);
+  }
+}
+
+void SharedMemoryTransport::Receive(size_t dest_tile,
+                                    std::vector<Boid> &boids) {
+  if (dest_tile >= num_tiles_) {
+    throw std::out_of_range("No mailbox for tile " +
+                            std::to_string(dest_tile));
+  }
+
+  SharedMailbox *mailbox =
+      reinterpret_cast<SharedMailbox *>(data_ + dest_tile * mailbox_stride_);
+  size_t num_records = (size_t)std::min<uint64_t>(
+      mailbox->num_records.load(std::memory_order_relaxed), capacity_);
+
+  const BoidRecord *records = RecordsOf(mailbox);
+  boids.reserve(boids.size() + num_records);
+  for (size_t i = 0; i < num_records; i++) {
+    boids.push_back(FromRecord(records[i]));
+  }
+
+  mailbox->num_records.store(0, std::memory_order_relaxed);
+}
+
+bool SharedMemoryTransport::reaches_other_processes() const { return true; }
+
+void SharedMemoryTransport::Close() {
+#ifndef _WIN32
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+  }
+#endif
+
+  data_ = nullptr;
+  size_ = 0;
+  num_tiles_ = 0;
+  capacity_ = 0;
+}
+
+} // namespace boid_sim
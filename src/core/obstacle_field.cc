@@ -0,0 +1,234 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "core/obstacle_field.h"
+
+namespace boid_sim {
+
+namespace {
+
+float DistanceToSegment(const glm::vec2 &point, const glm::vec2 &start,
+                        const glm::vec2 &end) {
+  glm::vec2 segment = end - start;
+  float length_squared = glm::dot(segment, segment);
+  float along = 0.0f;
+
+  if (length_squared > 0.0f) {
+    along = glm::dot(point - start, segment) / length_squared;
+    along = std::max(0.0f, std::min(1.0f, along));
+  }
+
+  return glm::distance(point, start + segment * along);
+}
+
+// Even-odd rule, so polygons may be concave
+bool InsidePolygon(const glm::vec2 &point,
+                   const std::vector<glm::vec2> &polygon) {
+  bool inside = false;
+
+  for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+    const glm::vec2 &vertex1 = polygon[i];
+    const glm::vec2 &vertex2 = polygon[j];
+
+    if ((vertex1.y > point.y) != (vertex2.y > point.y) &&
+        point.x < (vertex2.x - vertex1.x) * (point.y - vertex1.y) /
+                          (vertex2.y - vertex1.y) +
+                      vertex1.x) {
+      inside = !inside;
+    }
+  }
+
+  return inside;
+}
+
+} // namespace
+
+std::vector<std::vector<glm::vec2>> ReadObstacles(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("Could not open obstacle file " + path);
+  }
+
+  std::vector<std::vector<glm::vec2>> obstacles;
+  std::string line;
+  size_t line_number = 0;
+
+  while (std::getline(file, line)) {
+    line_number++;
+
+    std::istringstream coordinates(line);
+    std::vector<float> values;
+    std::string value;
+
+    while (coordinates >> value) {
+      if (value[0] == '#') {
+        break;
+      }
+
+      char *end = nullptr;
+      values.push_back(std::strtof(value.c_str(), &end));
+
+      if (*end != '\0') {
+        throw std::invalid_argument(path + ":" + std::to_string(line_number) +
+                                    " has a coordinate that is not a number!");
+      }
+    }
+
+    if (values.empty()) {
+      continue;
+    } else if (values.size() % 2 != 0 || values.size() < 6) {
+      throw std::invalid_argument(path + ":" + std::to_string(line_number) +
+                                  " is not a polygon of at least 3 vertices!");
+    }
+
+    std::vector<glm::vec2> polygon;
+    for (size_t i = 0; i < values.size(); i += 2) {
+      polygon.emplace_back(values[i], values[i + 1]);
+    }
+
+    obstacles.push_back(polygon);
+  }
+
+  return obstacles;
+}
+
+ObstacleField::ObstacleField()
+    : origin_(0, 0), cell_size_(1.0f), columns_(0), rows_(0) {}
+
+void ObstacleField::Bake(
+    const std::vector<std::vector<glm::vec2>> &obstacles,
+    const std::vector<std::vector<float>> &container_bounds, float cell_size,
+    bool solid_walls) {
+  if (!(cell_size > 0.0f)) {
+    throw std::invalid_argument("Obstacle field cell size was not positive!");
+  }
+
+  obstacles_ = obstacles;
+  origin_ = glm::vec2(container_bounds[0][0], container_bounds[1][0]);
+  cell_size_ = cell_size;
+
+  float width = container_bounds[0][1] - container_bounds[0][0];
+  float height = container_bounds[1][1] - container_bounds[1][0];
+  columns_ = std::max<size_t>(1, (size_t)std::ceil(width / cell_size_));
+  rows_ = std::max<size_t>(1, (size_t)std::ceil(height / cell_size_));
+
+  size_t node_columns = columns_ + 1;
+  size_t node_rows = rows_ + 1;
+  distances_.resize(node_columns * node_rows);
+  gradients_.resize(node_columns * node_rows);
+
+  // Nothing is further away than this, which keeps open space finite
+  float far_distance = width + height;
+
+  for (size_t row = 0; row < node_rows; row++) {
+    for (size_t column = 0; column < node_columns; column++) {
+      glm::vec2 node = origin_ + glm::vec2(column, row) * cell_size_;
+      float distance = std::min(far_distance, ObstacleDistance(node));
+
+      if (solid_walls) {
+        float wall_distance =
+            std::min(std::min(node.x - container_bounds[0][0],
+                              container_bounds[0][1] - node.x),
+                     std::min(node.y - container_bounds[1][0],
+                              container_bounds[1][1] - node.y));
+        distance = std::min(distance, wall_distance);
+      }
+
+      distances_[row * node_columns + column] = distance;
+    }
+  }
+
+  // Central differences inside the grid, one sided along its edges
+  for (size_t row = 0; row < node_rows; row++) {
+    for (size_t column = 0; column < node_columns; column++) {
+      size_t left = column > 0 ? column - 1 : column;
+      size_t right = column + 1 < node_columns ? column + 1 : column;
+      size_t below = row > 0 ? row - 1 : row;
+      size_t above = row + 1 < node_rows ? row + 1 : row;
+
+      glm::vec2 gradient(
+          (distances_[row * node_columns + right] -
+           distances_[row * node_columns + left]) /
+              (std::max<size_t>(1, right - left) * cell_size_),
+          (distances_[above * node_columns + column] -
+           distances_[below * node_columns + column]) /
+              (std::max<size_t>(1, above - below) * cell_size_));
+
+      gradients_[row * node_columns + column] = gradient;
+    }
+  }
+}
+
+float ObstacleField::Sample(const glm::vec2 &position,
+                            glm::vec2 &gradient) const {
+  if (distances_.empty()) {
+    gradient = glm::vec2(0, 0);
+    return std::numeric_limits<float>::max();
+  }
+
+  glm::vec2 extent = glm::vec2(columns_, rows_) * cell_size_;
+  glm::vec2 inside = glm::clamp(position - origin_, glm::vec2(0, 0), extent);
+
+  float column_coordinate = inside.x / cell_size_;
+  float row_coordinate = inside.y / cell_size_;
+  size_t column = std::min(columns_ - 1, (size_t)column_coordinate);
+  size_t row = std::min(rows_ - 1, (size_t)row_coordinate);
+  float x_weight = column_coordinate - column;
+  float y_weight = row_coordinate - row;
+
+  size_t node_columns = columns_ + 1;
+  size_t nodes[4] = {row * node_columns + column,
+                     row * node_columns + column + 1,
+                     (row + 1) * node_columns + column,
+                     (row + 1) * node_columns + column + 1};
+  float weights[4] = {(1 - x_weight) * (1 - y_weight),
+                      x_weight * (1 - y_weight), (1 - x_weight) * y_weight,
+                      x_weight * y_weight};
+
+  float distance = 0.0f;
+  gradient = glm::vec2(0, 0);
+
+  for (size_t corner = 0; corner < 4; corner++) {
+    distance += distances_[nodes[corner]] * weights[corner];
+    gradient += gradients_[nodes[corner]] * weights[corner];
+  }
+
+  // Carry on along the edge's gradient for positions off the grid
+  return distance + glm::dot(gradient, position - origin_ - inside);
+}
+
+const std::vector<std::vector<glm::vec2>> &ObstacleField::obstacles() const {
+  return obstacles_;
+}
+
+size_t ObstacleField::columns() const { return columns_; }
+
+size_t ObstacleField::rows() const { return rows_; }
+
+float ObstacleField::cell_size() const { return cell_size_; }
+
+float ObstacleField::ObstacleDistance(const glm::vec2 &point) const {
+  float distance = std::numeric_limits<float>::max();
+  bool inside = false;
+
+  for (const std::vector<glm::vec2> &polygon : obstacles_) {
+    for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+      distance = std::min(distance,
+                          DistanceToSegment(point, polygon[j], polygon[i]));
+    }
+
+    inside = inside || InsidePolygon(point, polygon);
+  }
+
+  return inside ? -distance : distance;
+}
+
+} // namespace boid_sim
@@ -0,0 +1,159 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/parallel_for.h"
+
+namespace boid_sim {
+
+namespace {
+
+/*
+ * Threads shared by every ParallelFor call. They are started the first time a
+ * call needs them and then wait for the next one, so stepping a frame never
+ * starts a thread. Thread i always runs chunk i of a call.
+ */
+class ChunkPool {
+public:
+  ~ChunkPool() {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      stopping_ = true;
+    }
+
+    started_.notify_all();
+
+    for (std::thread &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  /*
+   * Runs run_chunk on every chunk, the first one on the calling thread.
+   * Returns false without running anything if another call is using the
+   * pool, for instance one made from inside a chunk.
+   */
+  bool TryRun(size_t num_chunks, const std::function<void(size_t)> &run_chunk) {
+    std::unique_lock<std::mutex> busy(busy_lock_, std::try_to_lock);
+    if (!busy.owns_lock()) {
+      return false;
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      while (threads_.size() + 1 < num_chunks) {
+        threads_.emplace_back(&ChunkPool::ThreadLoop, this,
+                              threads_.size() + 1, batch_);
+      }
+
+      work_ = &run_chunk;
+      num_chunks_ = num_chunks;
+      num_running_ = num_chunks - 1;
+      batch_++;
+    }
+
+    started_.notify_all();
+    run_chunk(0);
+
+    std::unique_lock<std::mutex> lock(lock_);
+    finished_.wait(lock, [this] { return num_running_ == 0; });
+    work_ = nullptr;
+
+    return true;
+  }
+
+private:
+  std::mutex busy_lock_;
+  std::mutex lock_;
+  std::condition_variable started_;
+  std::condition_variable finished_;
+  std::vector<std::thread> threads_;
+  const std::function<void(size_t)> *work_ = nullptr;
+  size_t num_chunks_ = 0;
+  size_t num_running_ = 0;
+  size_t batch_ = 0;
+  bool stopping_ = false;
+
+  void ThreadLoop(size_t chunk, size_t last_batch) {
+    while (true) {
+      const std::function<void(size_t)> *work;
+
+      {
+        std::unique_lock<std::mutex> lock(lock_);
+        started_.wait(lock,
+                      [&] { return stopping_ || batch_ != last_batch; });
+
+        if (stopping_) {
+          return;
+        }
+
+        last_batch = batch_;
+        if (chunk >= num_chunks_) {
+          // This call needs fewer threads than the pool has
+          continue;
+        }
+
+        work = work_;
+      }
+
+      (*work)(chunk);
+
+      std::lock_guard<std::mutex> guard(lock_);
+      if (--num_running_ == 0) {
+        finished_.notify_one();
+      }
+    }
+  }
+};
+
+} // namespace
+
+void ParallelFor(size_t begin, size_t end, size_t num_threads,
+                 const std::function<void(size_t, size_t)> &work) {
+  if (end <= begin) {
+    return;
+  }
+
+  size_t count = end - begin;
+  num_threads = std::max<size_t>(1, std::min(num_threads, count));
+  size_t chunk_size = (count + num_threads - 1) / num_threads;
+  size_t num_chunks = (count + chunk_size - 1) / chunk_size;
+
+  if (num_chunks == 1) {
+    work(begin, end);
+    return;
+  }
+
+  // Capturing just one pointer lets std::function hold the chunk runner
+  // without allocating
+  struct Chunks {
+    size_t begin;
+    size_t end;
+    size_t chunk_size;
+    const std::function<void(size_t, size_t)> *work;
+  } chunks = {begin, end, chunk_size, &work};
+
+  std::function<void(size_t)> run_chunk = [&chunks](size_t chunk) {
+    size_t chunk_begin = chunks.begin + chunk * chunks.chunk_size;
+    (*chunks.work)(chunk_begin,
+                   std::min(chunks.end, chunk_begin + chunks.chunk_size));
+  };
+
+  static ChunkPool pool;
+  if (!pool.TryRun(num_chunks, run_chunk)) {
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+      run_chunk(chunk);
+    }
+  }
+}
+
+size_t DefaultThreadCount() {
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+} // namespace boid_sim
@@ -0,0 +1,292 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "core/shared_state.h"
+
+namespace boid_sim {
+
+namespace {
+
+const char kSharedStateMagic[8] = {'B', 'O', 'I', 'D', 'S', 'H', 'M', '1'};
+const uint32_t kSharedStateVersion = 1;
+
+// Slots start on their own cache lines, so a reader copying one slot never
+// shares a line with the writer filling the next
+const size_t kCacheLine = 64;
+
+size_t RoundUpToLine(size_t bytes) {
+  return (bytes + kCacheLine - 1) / kCacheLine * kCacheLine;
+}
+
+size_t SlotStride(size_t capacity) {
+  return RoundUpToLine(sizeof(SharedSlotHeader) +
+                       capacity * sizeof(BoidRecord));
+}
+
+SharedSlotHeader *SlotAt(uint8_t *data, const SharedStateHeader &header,
+                         size_t slot) {
+  return reinterpret_cast<SharedSlotHeader *>(
+      data + RoundUpToLine(sizeof(SharedStateHeader)) +
+      slot * header.slot_stride);
+}
+
+BoidRecord *RecordsOf(SharedSlotHeader *slot) {
+  return reinterpret_cast<BoidRecord *>(reinterpret_cast<uint8_t *>(slot) +
+                                        sizeof(SharedSlotHeader));
+}
+
+const BoidRecord *RecordsOf(const SharedSlotHeader *slot) {
+  return reinterpret_cast<const BoidRecord *>(
+      reinterpret_cast<const uint8_t *>(slot) + sizeof(SharedSlotHeader));
+}
+
+} // namespace
+
+SharedStateWriter::SharedStateWriter(const std::string &name,
+                                     size_t capacity, size_t num_slots)
+    : name_(name), data_(nullptr), size_(0), header_(nullptr) {
+  if (num_slots == 0) {
+    throw std::invalid_argument("Shared state needs at least one slot");
+  }
+
+  // Readers in other processes share the counters, which only works if
+  // they are plain memory rather than a lock kept by each process
+  std::atomic<uint64_t> counter(0);
+  if (!counter.is_lock_free()) {
+    throw std::runtime_error("Shared state needs lock free 64-bit atomics");
+  }
+
+#ifndef _WIN32
+  size_ = RoundUpToLine(sizeof(SharedStateHeader)) +
+          num_slots * SlotStride(capacity);
+
+  // Readers still mapping a segment left under this name keep it until they
+  // let go, and see it as closed
+  shm_unlink(name_.c_str());
+
+  int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) {
+    throw std::runtime_error("Could not create shared memory " + name_);
+  }
+
+  if (ftruncate(fd, (off_t)size_) != 0) {
+    close(fd);
+    shm_unlink(name_.c_str());
+    throw std::runtime_error("Could not size shared memory " + name_);
+  }
+
+  void *mapping =
+      mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (mapping == MAP_FAILED) {
+    shm_unlink(name_.c_str());
+    throw std::runtime_error("Could not map shared memory " + name_);
+  }
+
+  data_ = static_cast<uint8_t *>(mapping);
+
+  // The segment starts out zeroed. The magic is written last, so a reader
+  // that opens it halfway through setting up turns it away.
+  header_ = new (data_) SharedStateHeader();
+  header_->version = kSharedStateVersion;
+  header_->record_size = sizeof(BoidRecord);
+  header_->num_slots = (uint32_t)num_slots;
+  header_->capacity = (uint32_t)capacity;
+  header_->slot_stride = SlotStride(capacity);
+  header_->num_published.store(0, std::memory_order_relaxed);
+  header_->closed.store(0, std::memory_order_relaxed);
+
+  for (size_t slot = 0; slot < num_slots; slot++) {
+    SharedSlotHeader *slot_header = new (SlotAt(data_, *header_, slot))
+        SharedSlotHeader();
+    slot_header->sequence.store(0, std::memory_order_relaxed);
+  }
+
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(header_->magic, kSharedStateMagic, sizeof(header_->magic));
+#else
+  (void)capacity;
+  throw std::runtime_error("Shared state export needs POSIX shared memory");
+#endif
+}
+
+SharedStateWriter::~SharedStateWriter() {
+#ifndef _WIN32
+  if (data_ != nullptr) {
+    header_->closed.store(1, std::memory_order_release);
+    munmap(data_, size_);
+    shm_unlink(name_.c_str());
+    data_ = nullptr;
+  }
+#endif
+}
+
+void SharedStateWriter::Publish(
+    uint64_t frame, const std::vector<std::vector<float>> &container_bounds,
+    const std::vector<Boid> &boids) {
+  if (boids.size() > header_->capacity) {
+    throw std::invalid_argument("More boids than the shared state can hold");
+  }
+
+  SharedSlotHeader *slot =
+      SlotAt(data_, *header_, num_published_ % header_->num_slots);
+
+  // Odd while the slot is being filled. The fence keeps the writes below from
+  // being seen before readers can tell the slot is busy.
+  uint64_t sequence = slot->sequence.load(std::memory_order_relaxed);
+  slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot->frame = frame;
+  slot->num_boids = boids.size();
+  for (size_t axis = 0; axis < 2; axis++) {
+    for (size_t side = 0; side < 2; side++) {
+      slot->container_bounds[axis][side] =
+          axis < container_bounds.size() ? container_bounds[axis][side] : 0.0f;
+    }
+  }
+
+  BoidRecord *records = RecordsOf(slot);
+  for (size_t index = 0; index < boids.size(); index++) {
+    records[index] = ToRecord(boids[index]);
+  }
+
+  slot->sequence.store(sequence + 2, std::memory_order_release);
+
+  num_published_++;
+  header_->num_published.store(num_published_, std::memory_order_release);
+}
+
+const std::string &SharedStateWriter::name() const { return name_; }
+
+size_t SharedStateWriter::capacity() const { return header_->capacity; }
+
+size_t SharedStateWriter::num_slots() const { return header_->num_slots; }
+
+uint64_t SharedStateWriter::num_published() const { return num_published_; }
+
+SharedStateReader::SharedStateReader(const std::string &name)
+    : data_(nullptr), size_(0), header_(nullptr) {
+#ifndef _WIN32
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open shared memory " + name);
+  }
+
+  struct stat segment_stat;
+  if (fstat(fd, &segment_stat) != 0) {
+    close(fd);
+    throw std::runtime_error("Could not read size of shared memory " + name);
+  }
+
+  size_ = (size_t)segment_stat.st_size;
+  if (size_ < sizeof(SharedStateHeader)) {
+    close(fd);
+    throw std::runtime_error("Shared memory " + name + " is not ready");
+  }
+
+  void *mapping = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Could not map shared memory " + name);
+  }
+
+  data_ = static_cast<uint8_t *>(mapping);
+  header_ = reinterpret_cast<const SharedStateHeader *>(data_);
+
+  bool valid = std::memcmp(header_->magic, kSharedStateMagic,
+                           sizeof(kSharedStateMagic)) == 0;
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  valid = valid && header_->version == kSharedStateVersion &&
+          header_->record_size == sizeof(BoidRecord) &&
+          header_->num_slots > 0 &&
+          header_->slot_stride == SlotStride(header_->capacity) &&
+          RoundUpToLine(sizeof(SharedStateHeader)) +
+                  header_->num_slots * header_->slot_stride <=
+              size_;
+
+  if (!valid) {
+    munmap(data_, size_);
+    throw std::runtime_error("Shared memory " + name +
+                             " is not boid state, or is not ready");
+  }
+#else
+  (void)name;
+  throw std::runtime_error("Shared state export needs POSIX shared memory");
+#endif
+}
+
+SharedStateReader::~SharedStateReader() {
+#ifndef _WIN32
+  if (data_ != nullptr) {
+    munmap(data_, size_);
+    data_ = nullptr;
+  }
+#endif
+}
+
+bool SharedStateReader::ReadLatest(SharedFrame &frame) {
+  while (true) {
+    uint64_t num_published =
+        header_->num_published.load(std::memory_order_acquire);
+    if (num_published == 0) {
+      return false;
+    }
+
+    const SharedSlotHeader *slot = SlotAt(
+        data_, *header_, (num_published - 1) % header_->num_slots);
+
+    uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+    if (sequence % 2 == 1) {
+      num_retries_++;
+      continue;
+    }
+
+    // The count may be torn if the slot is being overwritten, so it is kept
+    // in bounds before copying and the copy is checked afterwards
+    size_t num_boids =
+        std::min<uint64_t>(slot->num_boids, header_->capacity);
+    frame.frame = slot->frame;
+    std::memcpy(frame.container_bounds, slot->container_bounds,
+                sizeof(frame.container_bounds));
+    frame.boids.resize(num_boids);
+    std::memcpy(frame.boids.data(), RecordsOf(slot),
+                num_boids * sizeof(BoidRecord));
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->sequence.load(std::memory_order_relaxed) == sequence) {
+      return true;
+    }
+
+    num_retries_++;
+  }
+}
+
+uint64_t SharedStateReader::num_published() const {
+  return header_->num_published.load(std::memory_order_acquire);
+}
+
+bool SharedStateReader::writer_closed() const {
+  return header_->closed.load(std::memory_order_acquire) != 0;
+}
+
+size_t SharedStateReader::capacity() const { return header_->capacity; }
+
+uint64_t SharedStateReader::num_retries() const { return num_retries_; }
+
+} // namespace boid_sim
@@ -0,0 +1,285 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+
+#include "core/sparse_grid.h"
+
+namespace boid_sim {
+
+namespace {
+
+const size_t kMinCapacity = 16;
+
+// Cell coordinates are clamped well inside int32 so neighbors never overflow
+const float kMaxCoordinate = 1 << 30;
+
+} // namespace
+
+const uint32_t SparseGrid::kEmptySlot;
+
+SparseGrid::SparseGrid()
+    : cell_size_(1.0f), table_(kMinCapacity, Slot{0, 0, kEmptySlot}),
+      mask_(kMinCapacity - 1), shift_(60), cell_starts_(1, 0) {}
+
+void SparseGrid::Build(const std::vector<glm::vec2> &positions,
+                       float cell_size) {
+  cell_size_ = cell_size > 0.0f ? cell_size : 1.0f;
+
+  // Forget last frame's cells, leaving the table at its old size
+  for (size_t cell = 0; cell < cell_columns_.size(); cell++) {
+    size_t slot = SlotOf(cell_columns_[cell], cell_rows_[cell]);
+    while (table_[slot].cell != kEmptySlot) {
+      table_[slot].cell = kEmptySlot;
+      slot = (slot + 1) & mask_;
+    }
+  }
+
+  cell_columns_.clear();
+  cell_rows_.clear();
+
+  size_t num_positions = positions.size();
+  cell_of_.resize(num_positions);
+  entries_.resize(num_positions);
+
+  for (size_t i = 0; i < num_positions; i++) {
+    cell_of_[i] = Insert(CoordinateOf(positions[i].x),
+                         CoordinateOf(positions[i].y));
+  }
+
+  SortCells();
+
+  // Counting sort, which keeps every cell in ascending index order
+  cell_starts_.assign(num_cells() + 1, 0);
+  for (size_t i = 0; i < num_positions; i++) {
+    cell_starts_[cell_of_[i] + 1]++;
+  }
+
+  for (size_t cell = 0; cell < num_cells(); cell++) {
+    cell_starts_[cell + 1] += cell_starts_[cell];
+  }
+
+  cursors_.assign(cell_starts_.begin(), cell_starts_.end() - 1);
+  for (size_t i = 0; i < num_positions; i++) {
+    entries_[cursors_[cell_of_[i]]++] = i;
+  }
+}
+
+void SparseGrid::Gather(const glm::vec2 &center, float radius,
+                        std::vector<size_t> &indices) const {
+  indices.clear();
+
+  int32_t min_column = CoordinateOf(center.x - radius);
+  int32_t max_column = CoordinateOf(center.x + radius);
+  int32_t min_row = CoordinateOf(center.y - radius);
+  int32_t max_row = CoordinateOf(center.y + radius);
+
+  double num_covered =
+      ((double)max_column - min_column + 1) * ((double)max_row - min_row + 1);
+
+  if (num_covered > (double)num_cells()) {
+    // Probing every covered cell would cost more than a pass over all cells
+    for (size_t cell = 0; cell < num_cells(); cell++) {
+      if (cell_columns_[cell] >= min_column &&
+          cell_columns_[cell] <= max_column && cell_rows_[cell] >= min_row &&
+          cell_rows_[cell] <= max_row) {
+        indices.insert(indices.end(), entries_.begin() + cell_starts_[cell],
+                       entries_.begin() + cell_starts_[cell + 1]);
+      }
+    }
+
+    return;
+  }
+
+  for (int32_t row = min_row; row <= max_row; row++) {
+    for (int32_t column = min_column; column <= max_column; column++) {
+      uint32_t first = Find(column, row);
+      if (first == kEmptySlot) {
+        continue;
+      }
+
+      // Cells are stored row by row, so the occupied cells that follow in
+      // this row are already next to each other and get copied in one span
+      size_t last = first + 1;
+      while (last < num_cells() && cell_rows_[last] == row &&
+             cell_columns_[last] <= max_column) {
+        last++;
+      }
+
+      indices.insert(indices.end(), entries_.begin() + cell_starts_[first],
+                     entries_.begin() + cell_starts_[last]);
+      column = cell_columns_[last - 1];
+    }
+  }
+}
+
+void SparseGrid::Gather(const glm::vec2 &center, float radius,
+                        const VisionCone &cone,
+                        std::vector<size_t> &indices) const {
+  if (cone.is_full()) {
+    Gather(center, radius, indices);
+    return;
+  }
+
+  indices.clear();
+
+  int32_t min_column = CoordinateOf(center.x - radius);
+  int32_t max_column = CoordinateOf(center.x + radius);
+  int32_t min_row = CoordinateOf(center.y - radius);
+  int32_t max_row = CoordinateOf(center.y + radius);
+
+  for (int32_t row = min_row; row <= max_row; row++) {
+    for (int32_t column = min_column; column <= max_column; column++) {
+      // Checking the cone first also saves probing the table for the cell
+      glm::vec2 corner(column * cell_size_, row * cell_size_);
+      if (!cone.MayOverlapCell(corner, cell_size_)) {
+        continue;
+      }
+
+      uint32_t cell = Find(column, row);
+      if (cell != kEmptySlot) {
+        indices.insert(indices.end(), entries_.begin() + cell_starts_[cell],
+                       entries_.begin() + cell_starts_[cell + 1]);
+      }
+    }
+  }
+}
+
+size_t SparseGrid::CellOf(const glm::vec2 &position) const {
+  uint32_t cell = Find(CoordinateOf(position.x), CoordinateOf(position.y));
+  return cell == kEmptySlot ? num_cells() : cell;
+}
+
+const std::vector<size_t> &SparseGrid::cell_starts() const {
+  return cell_starts_;
+}
+
+const std::vector<size_t> &SparseGrid::entries() const { return entries_; }
+
+size_t SparseGrid::num_cells() const { return cell_columns_.size(); }
+
+size_t SparseGrid::capacity() const { return table_.size(); }
+
+float SparseGrid::cell_size() const { return cell_size_; }
+
+size_t SparseGrid::memory_bytes() const {
+  return table_.capacity() * sizeof(Slot) +
+         (cell_columns_.capacity() + cell_rows_.capacity()) * sizeof(int32_t) +
+         cell_starts_.capacity() * sizeof(size_t);
+}
+
+int32_t SparseGrid::CoordinateOf(float coordinate) const {
+  float cell = std::floor(coordinate / cell_size_);
+
+  // NaN lands in cell 0 like it does in SpatialGrid
+  if (!(cell == cell)) {
+    return 0;
+  }
+
+  return (int32_t)std::max(-kMaxCoordinate, std::min(kMaxCoordinate, cell));
+}
+
+size_t SparseGrid::SlotOf(int32_t column, int32_t row) const {
+  // Fibonacci hashing, the top bits of the product mix in every key bit
+  uint64_t key = ((uint64_t)(uint32_t)column << 32) | (uint32_t)row;
+  key = (key ^ (key >> 31)) * 0x9E3779B97F4A7C15ull;
+
+  return (size_t)(key >> shift_);
+}
+
+uint32_t SparseGrid::Find(int32_t column, int32_t row) const {
+  size_t slot = SlotOf(column, row);
+
+  while (table_[slot].cell != kEmptySlot) {
+    if (table_[slot].column == column && table_[slot].row == row) {
+      return table_[slot].cell;
+    }
+
+    slot = (slot + 1) & mask_;
+  }
+
+  return kEmptySlot;
+}
+
+uint32_t SparseGrid::Insert(int32_t column, int32_t row) {
+  size_t slot = SlotOf(column, row);
+
+  while (table_[slot].cell != kEmptySlot) {
+    if (table_[slot].column == column && table_[slot].row == row) {
+      return table_[slot].cell;
+    }
+
+    slot = (slot + 1) & mask_;
+  }
+
+  uint32_t cell = (uint32_t)num_cells();
+  table_[slot] = Slot{column, row, cell};
+  cell_columns_.push_back(column);
+  cell_rows_.push_back(row);
+
+  // Linear probing slows down sharply past half full
+  if (num_cells() * 2 > capacity()) {
+    Rehash(capacity() * 2);
+  }
+
+  return cell;
+}
+
+void SparseGrid::SortCells() {
+  cell_order_.resize(num_cells());
+  for (size_t cell = 0; cell < num_cells(); cell++) {
+    cell_order_[cell] = cell;
+  }
+
+  std::sort(cell_order_.begin(), cell_order_.end(),
+            [this](size_t cell1, size_t cell2) {
+              return cell_rows_[cell1] != cell_rows_[cell2]
+                         ? cell_rows_[cell1] < cell_rows_[cell2]
+                         : cell_columns_[cell1] < cell_columns_[cell2];
+            });
+
+  // cell_renumber_ maps each cell's insertion number to its sorted number
+  cell_renumber_.resize(num_cells());
+  sorted_columns_.resize(num_cells());
+  sorted_rows_.resize(num_cells());
+
+  for (size_t cell = 0; cell < num_cells(); cell++) {
+    cell_renumber_[cell_order_[cell]] = cell;
+    sorted_columns_[cell] = cell_columns_[cell_order_[cell]];
+    sorted_rows_[cell] = cell_rows_[cell_order_[cell]];
+  }
+
+  cell_columns_.swap(sorted_columns_);
+  cell_rows_.swap(sorted_rows_);
+
+  for (Slot &slot : table_) {
+    if (slot.cell != kEmptySlot) {
+      slot.cell = (uint32_t)cell_renumber_[slot.cell];
+    }
+  }
+
+  for (size_t &cell : cell_of_) {
+    cell = cell_renumber_[cell];
+  }
+}
+
+void SparseGrid::Rehash(size_t capacity) {
+  table_.assign(capacity, Slot{0, 0, kEmptySlot});
+  mask_ = capacity - 1;
+  shift_ = 64;
+  for (size_t slots = capacity; slots > 1; slots /= 2) {
+    shift_--;
+  }
+
+  for (size_t cell = 0; cell < num_cells(); cell++) {
+    size_t slot = SlotOf(cell_columns_[cell], cell_rows_[cell]);
+    while (table_[slot].cell != kEmptySlot) {
+      slot = (slot + 1) & mask_;
+    }
+
+    table_[slot] = Slot{cell_columns_[cell], cell_rows_[cell], (uint32_t)cell};
+  }
+}
+
+} // namespace boid_sim
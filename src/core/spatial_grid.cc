@@ -0,0 +1,67 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include "core/spatial_grid.h"
+
+namespace boid_sim {
+
+SpatialGrid::SpatialGrid() : BasicSpatialGrid<2>(false) {}
+
+void SpatialGrid::Gather(const glm::vec2 &center, float radius,
+                         const VisionCone &cone,
+                         std::vector<size_t> &indices) const {
+  if (cone.is_full()) {
+    Gather(center, radius, indices);
+    return;
+  }
+
+  indices.clear();
+
+  size_t min_column, max_column, min_row, max_row;
+  CellRange(center, radius, min_column, max_column, min_row, max_row);
+
+  size_t num_columns = columns();
+  size_t num_rows = rows();
+  const std::vector<size_t> &starts = cell_starts();
+  const std::vector<size_t> &stored = entries();
+
+  for (size_t row = min_row; row <= max_row; row++) {
+    bool edge_row = row == 0 || row + 1 == num_rows;
+    size_t run_start = min_column;
+
+    // Copies each run of kept cells in the row as one span
+    for (size_t column = min_column; column <= max_column + 1; column++) {
+      bool keep = false;
+
+      if (column <= max_column) {
+        glm::vec2 corner =
+            origin() + glm::vec2(column * cell_size(), row * cell_size());
+        keep = edge_row || column == 0 || column + 1 == num_columns ||
+               cone.MayOverlapCell(corner, cell_size());
+      }
+
+      if (!keep) {
+        size_t first = starts[row * num_columns + run_start];
+        size_t last = starts[row * num_columns + column];
+        indices.insert(indices.end(), stored.begin() + first,
+                       stored.begin() + last);
+        run_start = column + 1;
+      }
+    }
+  }
+}
+
+void SpatialGrid::CellRange(const glm::vec2 &center, float radius,
+                            size_t &min_column, size_t &max_column,
+                            size_t &min_row, size_t &max_row) const {
+  min_column = CoordinateOf(center.x - radius, 0);
+  max_column = CoordinateOf(center.x + radius, 0);
+  min_row = CoordinateOf(center.y - radius, 1);
+  max_row = CoordinateOf(center.y + radius, 1);
+}
+
+size_t SpatialGrid::columns() const { return cells_along(0); }
+
+size_t SpatialGrid::rows() const { return cells_along(1); }
+
+} // namespace boid_sim
@@ -0,0 +1,50 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include "core/swarm_rng.h"
+
+namespace boid_sim {
+
+SwarmRng::SwarmRng(uint64_t seed, uint64_t counter)
+    : seed_(seed), counter_(counter) {}
+
+uint64_t SwarmRng::Reserve(uint64_t count) {
+  uint64_t first = counter_;
+  counter_ += count;
+
+  return first;
+}
+
+uint64_t SwarmRng::Bits(uint64_t counter, uint32_t slot) const {
+  /*
+   * Two rounds of the SplitMix64 finalizer over (seed, counter, slot) are
+   * enough to decorrelate neighboring counters and slots.
+   */
+  uint64_t key = SplitMix64(seed_ ^ (0x9E3779B97F4A7C15ULL * (slot + 1)));
+
+  return SplitMix64(key ^ SplitMix64(counter));
+}
+
+float SwarmRng::Uniform(uint64_t counter, uint32_t slot) const {
+  // Top 24 bits fill the float mantissa exactly
+  return (float)(Bits(counter, slot) >> 40) * (1.0f / 16777216.0f);
+}
+
+float SwarmRng::Uniform(uint64_t counter, uint32_t slot, float min,
+                        float max) const {
+  return min + (max - min) * Uniform(counter, slot);
+}
+
+uint64_t SwarmRng::seed() const { return seed_; }
+
+uint64_t SwarmRng::counter() const { return counter_; }
+
+uint64_t SwarmRng::SplitMix64(uint64_t value) {
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+  return value ^ (value >> 31);
+}
+
+} // namespace boid_sim
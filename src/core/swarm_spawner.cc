@@ -0,0 +1,125 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+
+#include "core/parallel_for.h"
+#include "core/swarm_spawner.h"
+
+namespace boid_sim {
+
+namespace {
+
+// Draw slots, so every value a boid needs comes from its own stream
+const uint32_t kDirectionSlot = 0;
+const uint32_t kPositionSlotA = 1;
+const uint32_t kPositionSlotB = 2;
+const uint32_t kClusterSlot = 3;
+const uint32_t kClusterCenterSlotX = 4;
+const uint32_t kClusterCenterSlotY = 5;
+
+/**
+ * Returns a standard normal sample made from two uniform draws
+ */
+glm::vec2 Gaussian(const SwarmRng &rng, uint64_t counter) {
+  float u1 = 1.0f - rng.Uniform(counter, kPositionSlotA);
+  float u2 = rng.Uniform(counter, kPositionSlotB);
+  float radius = std::sqrt(-2.0f * std::log(u1));
+  float angle = 2.0f * (float)M_PI * u2;
+
+  return glm::vec2(radius * std::cos(angle), radius * std::sin(angle));
+}
+
+glm::vec2 Clamp(const glm::vec2 &position,
+                const std::vector<std::vector<float>> &container_bounds) {
+  return glm::vec2(std::min(std::max(position.x, container_bounds[0][0]),
+                            container_bounds[0][1]),
+                   std::min(std::max(position.y, container_bounds[1][0]),
+                            container_bounds[1][1]));
+}
+
+} // namespace
+
+void SpawnSwarm(const std::vector<std::vector<float>> &container_bounds,
+                size_t num_boids, const SpawnOptions &options, float max_speed,
+                float fov_radius, SwarmRng &rng, std::vector<Boid> &boids) {
+  float min_x = container_bounds[0][0];
+  float max_x = container_bounds[0][1];
+  float min_y = container_bounds[1][0];
+  float max_y = container_bounds[1][1];
+  float shorter_side = std::min(max_x - min_x, max_y - min_y);
+  glm::vec2 center((min_x + max_x) / 2.0f, (min_y + max_y) / 2.0f);
+
+  std::vector<glm::vec2> cluster_centers;
+  if (options.distribution == SpawnDistribution::kClustered) {
+    for (size_t i = 0; i < std::max<size_t>(1, options.num_clusters); i++) {
+      cluster_centers.push_back(
+          glm::vec2(rng.Uniform(i, kClusterCenterSlotX, min_x, max_x),
+                    rng.Uniform(i, kClusterCenterSlotY, min_y, max_y)));
+    }
+  }
+
+  uint64_t first_counter = rng.Reserve(num_boids);
+  std::vector<glm::vec2> positions(num_boids);
+  std::vector<glm::vec2> directions(num_boids);
+
+  size_t num_threads =
+      options.num_threads == 0 ? DefaultThreadCount() : options.num_threads;
+
+  ParallelFor(0, num_boids, num_threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      uint64_t counter = first_counter + i;
+      float heading = rng.Uniform(counter, kDirectionSlot, 0.0f,
+                                  2.0f * (float)M_PI);
+      directions[i] = glm::vec2(std::cos(heading), std::sin(heading));
+
+      switch (options.distribution) {
+      case SpawnDistribution::kUniform:
+        positions[i] = glm::vec2(rng.Uniform(counter, kPositionSlotA, min_x,
+                                             max_x),
+                                 rng.Uniform(counter, kPositionSlotB, min_y,
+                                             max_y));
+        break;
+
+      case SpawnDistribution::kClustered: {
+        size_t cluster = std::min(
+            (size_t)(rng.Uniform(counter, kClusterSlot) *
+                     cluster_centers.size()),
+            cluster_centers.size() - 1);
+        glm::vec2 offset = Gaussian(rng, counter) *
+                           (options.cluster_spread * shorter_side);
+        positions[i] = Clamp(cluster_centers[cluster] + offset,
+                             container_bounds);
+        break;
+      }
+
+      case SpawnDistribution::kRing: {
+        float angle = rng.Uniform(counter, kPositionSlotA, 0.0f,
+                                  2.0f * (float)M_PI);
+        float radius =
+            shorter_side *
+            (options.ring_radius +
+             options.ring_width *
+                 rng.Uniform(counter, kPositionSlotB, -.5f, .5f));
+        glm::vec2 spoke(std::cos(angle), std::sin(angle));
+        positions[i] = Clamp(center + spoke * radius, container_bounds);
+
+        // Start out circling the center rather than crossing the ring
+        directions[i] = glm::vec2(-spoke.y, spoke.x);
+        break;
+      }
+      }
+    }
+  });
+
+  boids.reserve(boids.size() + num_boids);
+  int first_id = (int)boids.size();
+
+  for (size_t i = 0; i < num_boids; i++) {
+    boids.push_back(Boid(first_id + (int)i, positions[i], directions[i],
+                         max_speed, fov_radius));
+  }
+}
+
+} // namespace boid_sim
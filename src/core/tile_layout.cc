@@ -0,0 +1,95 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+
+#include "core/tile_layout.h"
+
+namespace boid_sim {
+
+TileLayout::TileLayout(
+    const std::vector<std::vector<float>> &container_bounds, size_t tiles_x,
+    size_t tiles_y)
+    : tiles_x_(tiles_x), tiles_y_(tiles_y) {
+  if (tiles_x == 0 || tiles_y == 0) {
+    throw std::invalid_argument("Tile layout needs at least one tile!");
+  } else if (container_bounds.size() < 2) {
+    throw std::invalid_argument("Container bounds need an x and y range!");
+  }
+
+  origin_ = glm::vec2(container_bounds[0][0], container_bounds[1][0]);
+  tile_size_ =
+      glm::vec2((container_bounds[0][1] - container_bounds[0][0]) / tiles_x,
+                (container_bounds[1][1] - container_bounds[1][0]) / tiles_y);
+}
+
+size_t TileLayout::TileOf(const glm::vec2 &position) const {
+  return RowOf(position.y) * tiles_x_ + ColumnOf(position.x);
+}
+
+float TileLayout::DistanceToTile(const glm::vec2 &position,
+                                 size_t tile) const {
+  float dx = AxisDistance(position.x, tile % tiles_x_, tiles_x_, origin_.x,
+                          tile_size_.x);
+  float dy = AxisDistance(position.y, tile / tiles_x_, tiles_y_, origin_.y,
+                          tile_size_.y);
+
+  return std::sqrt(dx * dx + dy * dy);
+}
+
+void TileLayout::TilesWithin(const glm::vec2 &position, float radius,
+                             std::vector<size_t> &tiles) const {
+  tiles.clear();
+  size_t own_tile = TileOf(position);
+
+  size_t min_column = ColumnOf(position.x - radius);
+  size_t max_column = ColumnOf(position.x + radius);
+  size_t min_row = RowOf(position.y - radius);
+  size_t max_row = RowOf(position.y + radius);
+
+  for (size_t row = min_row; row <= max_row; row++) {
+    for (size_t column = min_column; column <= max_column; column++) {
+      size_t tile = row * tiles_x_ + column;
+
+      if (tile != own_tile && DistanceToTile(position, tile) <= radius) {
+        tiles.push_back(tile);
+      }
+    }
+  }
+}
+
+size_t TileLayout::num_tiles() const { return tiles_x_ * tiles_y_; }
+
+size_t TileLayout::tiles_x() const { return tiles_x_; }
+
+size_t TileLayout::tiles_y() const { return tiles_y_; }
+
+size_t TileLayout::ColumnOf(float x) const {
+  float column = std::floor((x - origin_.x) / tile_size_.x);
+
+  return (size_t)std::min(std::max(column, 0.0f), (float)(tiles_x_ - 1));
+}
+
+size_t TileLayout::RowOf(float y) const {
+  float row = std::floor((y - origin_.y) / tile_size_.y);
+
+  return (size_t)std::min(std::max(row, 0.0f), (float)(tiles_y_ - 1));
+}
+
+float TileLayout::AxisDistance(float value, size_t index, size_t count,
+                               float origin, float size) const {
+  float min_edge = origin + index * size;
+  float max_edge = origin + (index + 1) * size;
+
+  // Outer tiles are unbounded on their outward facing side
+  if (index > 0 && value < min_edge) {
+    return min_edge - value;
+  } else if (index + 1 < count && value > max_edge) {
+    return value - max_edge;
+  }
+
+  return 0.0f;
+}
+
+} // namespace boid_sim
@@ -0,0 +1,110 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <cmath>
+
+#include "core/vision_cone.h"
+
+namespace boid_sim {
+
+namespace {
+
+float Cross(const glm::vec2 &vector1, const glm::vec2 &vector2) {
+  return vector1.x * vector2.y - vector1.y * vector2.x;
+}
+
+glm::vec2 Rotate(const glm::vec2 &vector, float angle) {
+  float cos_angle = std::cos(angle);
+  float sin_angle = std::sin(angle);
+
+  return glm::vec2(vector.x * cos_angle - vector.y * sin_angle,
+                   vector.x * sin_angle + vector.y * cos_angle);
+}
+
+// Cells this close to an edge, relative to their size, are never skipped
+const float kEdgeMargin = 1e-3f;
+
+} // namespace
+
+VisionCone::VisionCone(const glm::vec2 &apex, const glm::vec2 &heading,
+                       float view_angle)
+    : apex_(apex), heading_(0, 0), view_cos_(-1.0f), view_cos_squared_(1.0f),
+      full_(view_angle >= 360.0f || glm::length(heading) == 0.0f) {
+  if (full_) {
+    return;
+  }
+
+  float half_angle = std::max(0.0f, view_angle) * (float)M_PI / 360.0f;
+  heading_ = glm::normalize(heading);
+  view_cos_ = std::cos(half_angle);
+  view_cos_squared_ = view_cos_ * view_cos_;
+
+  if (view_cos_ >= 0.0f) {
+    left_edge_ = Rotate(heading_, half_angle);
+    right_edge_ = Rotate(heading_, -half_angle);
+  } else {
+    // The blind spot is a narrower cone pointing backwards
+    float blind_angle = (float)M_PI - half_angle;
+    left_edge_ = Rotate(-heading_, blind_angle);
+    right_edge_ = Rotate(-heading_, -blind_angle);
+  }
+}
+
+bool VisionCone::Contains(const glm::vec2 &point) const {
+  if (full_) {
+    return true;
+  }
+
+  // dot >= view_cos * length, squared. The sign of the dot product says
+  // whether the point is ahead of the apex or behind it.
+  glm::vec2 offset = point - apex_;
+  float dot = glm::dot(offset, heading_);
+  float bound = view_cos_squared_ * glm::dot(offset, offset);
+
+  if (view_cos_ >= 0.0f) {
+    return dot >= 0.0f && dot * dot >= bound;
+  }
+
+  return dot >= 0.0f || dot * dot <= bound;
+}
+
+bool VisionCone::MayOverlapCell(const glm::vec2 &min_corner,
+                                float size) const {
+  if (full_) {
+    return true;
+  }
+
+  glm::vec2 corners[4] = {min_corner - apex_,
+                          min_corner + glm::vec2(size, 0) - apex_,
+                          min_corner + glm::vec2(0, size) - apex_,
+                          min_corner + glm::vec2(size, size) - apex_};
+  float margin = kEdgeMargin * size;
+
+  if (view_cos_ >= 0.0f) {
+    // The cone is convex, so a cell fully past one of its edges is outside
+    bool past_left = true;
+    bool past_right = true;
+
+    for (const glm::vec2 &corner : corners) {
+      past_left = past_left && Cross(corner, left_edge_) < -margin;
+      past_right = past_right && Cross(right_edge_, corner) < -margin;
+    }
+
+    return !(past_left || past_right);
+  }
+
+  // The blind spot is convex, so a cell with every corner in it is hidden
+  for (const glm::vec2 &corner : corners) {
+    if (!(Cross(corner, left_edge_) > margin &&
+          Cross(right_edge_, corner) > margin)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool VisionCone::is_full() const { return full_; }
+
+} // namespace boid_sim
@@ -0,0 +1,193 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+#include "core/work_stealing_scheduler.h"
+
+namespace boid_sim {
+
+WorkStealingScheduler::WorkStealingScheduler(size_t num_workers)
+    : num_steals_(0) {
+  set_num_workers(num_workers);
+}
+
+WorkStealingScheduler::WorkStealingScheduler(
+    const WorkStealingScheduler &source)
+    : num_steals_(0) {
+  set_num_workers(source.num_workers());
+}
+
+WorkStealingScheduler &
+WorkStealingScheduler::operator=(const WorkStealingScheduler &source) {
+  set_num_workers(source.num_workers());
+  return *this;
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() { StopThreads(); }
+
+void WorkStealingScheduler::Run(
+    const std::vector<size_t> &task_costs,
+    const std::function<void(size_t, size_t)> &work) {
+  num_steals_.store(0);
+
+  if (deques_.size() == 1) {
+    for (size_t task = 0; task < task_costs.size(); task++) {
+      work(task, 0);
+    }
+
+    return;
+  }
+
+  Deal(task_costs);
+
+  {
+    std::lock_guard<std::mutex> guard(run_lock_);
+    run_work_ = &work;
+    num_running_ = threads_.size();
+    run_++;
+  }
+
+  run_started_.notify_all();
+
+  WorkerLoop(0, work);
+
+  std::unique_lock<std::mutex> lock(run_lock_);
+  run_finished_.wait(lock, [this] { return num_running_ == 0; });
+  run_work_ = nullptr;
+}
+
+void WorkStealingScheduler::set_num_workers(size_t num_workers) {
+  num_workers = std::max<size_t>(1, num_workers);
+  if (deques_.size() == num_workers) {
+    return;
+  }
+
+  StopThreads();
+  deques_.clear();
+
+  for (size_t worker = 0; worker < num_workers; worker++) {
+    deques_.emplace_back(new WorkerDeque());
+  }
+
+  stopping_ = false;
+  for (size_t worker = 1; worker < num_workers; worker++) {
+    threads_.emplace_back(&WorkStealingScheduler::ThreadLoop, this, worker,
+                          run_);
+  }
+}
+
+size_t WorkStealingScheduler::num_workers() const { return deques_.size(); }
+
+size_t WorkStealingScheduler::num_steals() const { return num_steals_.load(); }
+
+void WorkStealingScheduler::StopThreads() {
+  {
+    std::lock_guard<std::mutex> guard(run_lock_);
+    stopping_ = true;
+  }
+
+  run_started_.notify_all();
+
+  for (std::thread &thread : threads_) {
+    thread.join();
+  }
+
+  threads_.clear();
+}
+
+void WorkStealingScheduler::ThreadLoop(size_t worker, size_t last_run) {
+  while (true) {
+    const std::function<void(size_t, size_t)> *work;
+
+    {
+      std::unique_lock<std::mutex> lock(run_lock_);
+      run_started_.wait(lock,
+                        [&] { return stopping_ || run_ != last_run; });
+
+      if (stopping_) {
+        return;
+      }
+
+      last_run = run_;
+      work = run_work_;
+    }
+
+    WorkerLoop(worker, *work);
+
+    std::lock_guard<std::mutex> guard(run_lock_);
+    if (--num_running_ == 0) {
+      run_finished_.notify_one();
+    }
+  }
+}
+
+void WorkStealingScheduler::Deal(const std::vector<size_t> &task_costs) {
+  order_.resize(task_costs.size());
+  std::iota(order_.begin(), order_.end(), 0);
+  // Ties go to the lower index, which keeps the order stable_sort would give
+  // without the buffer it allocates
+  std::sort(order_.begin(), order_.end(), [&](size_t a, size_t b) {
+    return task_costs[a] != task_costs[b] ? task_costs[a] > task_costs[b]
+                                          : a < b;
+  });
+
+  worker_costs_.assign(deques_.size(), 0);
+  for (std::unique_ptr<WorkerDeque> &deque : deques_) {
+    deque->tasks.clear();
+  }
+
+  for (size_t task : order_) {
+    size_t worker = std::min_element(worker_costs_.begin(),
+                                     worker_costs_.end()) -
+                    worker_costs_.begin();
+    deques_[worker]->tasks.push_back(task);
+    worker_costs_[worker] += task_costs[task];
+  }
+}
+
+void WorkStealingScheduler::WorkerLoop(
+    size_t worker, const std::function<void(size_t, size_t)> &work) {
+  size_t task;
+
+  // Nothing new is queued during a run, so once every deque is empty the
+  // worker is done
+  while (PopOwn(worker, task) || Steal(worker, task)) {
+    work(task, worker);
+  }
+}
+
+bool WorkStealingScheduler::PopOwn(size_t worker, size_t &task) {
+  WorkerDeque &deque = *deques_[worker];
+  std::lock_guard<std::mutex> guard(deque.lock);
+
+  if (deque.tasks.empty()) {
+    return false;
+  }
+
+  task = deque.tasks.front();
+  deque.tasks.pop_front();
+
+  return true;
+}
+
+bool WorkStealingScheduler::Steal(size_t worker, size_t &task) {
+  for (size_t offset = 1; offset < deques_.size(); offset++) {
+    WorkerDeque &victim = *deques_[(worker + offset) % deques_.size()];
+    std::lock_guard<std::mutex> guard(victim.lock);
+
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.back();
+      victim.tasks.pop_back();
+      num_steals_.fetch_add(1);
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace boid_sim
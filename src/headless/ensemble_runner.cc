@@ -0,0 +1,208 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "core/parallel_for.h"
+#include "headless/ensemble_runner.h"
+#include "visualizer/boid_container.h"
+
+namespace boid_sim {
+
+namespace headless {
+
+EnsembleRunner::EnsembleRunner(const EnsembleGrid &grid,
+                               const EnsembleSettings &settings)
+    : settings_(settings) {
+  for (size_t replica = 0; replica < settings.num_replicas; replica++) {
+    // Runs of a replica share a seed, so they only differ by parameters
+    uint64_t seed = settings.spawn_options.seed + replica;
+
+    for (size_t num_boids : grid.boid_counts) {
+      for (float max_speed : grid.max_speeds) {
+        for (float fov_radius : grid.fov_radii) {
+          // The weights are swept innermost, and are the only thing that
+          // differs between the runs of a starting swarm
+          size_t swarm = swarm_runs_.size();
+          swarm_runs_.push_back(runs_.size());
+
+          for (float align_percent : grid.align_percents) {
+            for (float cohesion_percent : grid.cohesion_percents) {
+              for (float separation_percent : grid.separation_percents) {
+                EnsembleRun run;
+                run.index = runs_.size();
+                run.replica = replica;
+                run.seed = seed;
+                run.num_boids = num_boids;
+                run.flocking_params.align_percent = align_percent;
+                run.flocking_params.cohesion_percent = cohesion_percent;
+                run.flocking_params.separation_percent = separation_percent;
+                run.flocking_params.fov_radius = fov_radius;
+                run.flocking_params.max_speed = max_speed;
+                run.swarm = swarm;
+
+                runs_.push_back(run);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+namespace {
+
+/*
+ * Starting swarm shared by the runs that only differ in their weights. It is
+ * spawned by the first of them to start and freed once the last one is done.
+ */
+struct SharedSwarm {
+  std::once_flag spawned;
+  std::unique_ptr<visualizer::BoidContainer> swarm;
+  std::atomic<size_t> runs_left;
+};
+
+} // namespace
+
+std::vector<RunSummary> EnsembleRunner::Run() const {
+  std::vector<SharedSwarm> swarms(swarm_runs_.size());
+  for (size_t i = 0; i < swarms.size(); i++) {
+    size_t end =
+        i + 1 < swarm_runs_.size() ? swarm_runs_[i + 1] : runs_.size();
+    swarms[i].runs_left = end - swarm_runs_[i];
+  }
+
+  std::vector<RunSummary> summaries(runs_.size());
+  std::atomic<size_t> next_run(0);
+  std::atomic<size_t> live_swarms(0);
+  std::atomic<size_t> peak_live_swarms(0);
+
+  size_t num_threads = settings_.num_threads == 0 ? DefaultThreadCount()
+                                                  : settings_.num_threads;
+
+  // Runs can take very different amounts of time, so workers grab the next
+  // unclaimed run instead of a fixed share of them. Runs of a swarm are next
+  // to each other, so only the swarms of the runs in flight are ever alive.
+  ParallelFor(0, num_threads, num_threads, [&](size_t, size_t) {
+    for (size_t i = next_run++; i < runs_.size(); i = next_run++) {
+      SharedSwarm &shared = swarms[runs_[i].swarm];
+
+      std::call_once(shared.spawned, [&] {
+        shared.swarm = BuildSwarm(runs_[i]);
+
+        size_t live = ++live_swarms;
+        size_t peak = peak_live_swarms.load();
+        while (peak < live &&
+               !peak_live_swarms.compare_exchange_weak(peak, live)) {
+        }
+      });
+
+      summaries[i] = RunOne(runs_[i], *shared.swarm);
+
+      if (--shared.runs_left == 0) {
+        shared.swarm.reset();
+        live_swarms--;
+      }
+    }
+  });
+
+  peak_live_swarms_ = peak_live_swarms;
+
+  return summaries;
+}
+
+void EnsembleRunner::WriteCsv(std::ostream &out,
+                              const std::vector<RunSummary> &summaries) {
+  out << "run,replica,seed,num_boids,align_percent,cohesion_percent,"
+         "separation_percent,fov_radius,max_speed,polarization,mean_speed,"
+         "mean_neighbors,num_flocks,largest_flock,out_of_bounds_fraction,"
+         "ms_per_frame\n";
+
+  for (const RunSummary &summary : summaries) {
+    const EnsembleRun &run = summary.run;
+    const FlockingParams &params = run.flocking_params;
+
+    out << run.index << ',' << run.replica << ',' << run.seed << ','
+        << run.num_boids << ',' << params.align_percent << ','
+        << params.cohesion_percent << ',' << params.separation_percent << ','
+        << params.fov_radius << ',' << params.max_speed << ','
+        << summary.polarization << ',' << summary.mean_speed << ','
+        << summary.mean_neighbors << ',' << summary.num_flocks << ','
+        << summary.largest_flock << ',' << summary.out_of_bounds_fraction
+        << ',' << summary.ms_per_frame << '\n';
+  }
+}
+
+const std::vector<EnsembleRun> &EnsembleRunner::runs() const { return runs_; }
+
+size_t EnsembleRunner::peak_live_swarms() const { return peak_live_swarms_; }
+
+std::unique_ptr<visualizer::BoidContainer>
+EnsembleRunner::BuildSwarm(const EnsembleRun &run) const {
+  SpawnOptions spawn_options = settings_.spawn_options;
+  spawn_options.seed = run.seed;
+  spawn_options.num_threads = 1;
+
+  return std::unique_ptr<visualizer::BoidContainer>(
+      new visualizer::BoidContainer(
+          settings_.container_width, settings_.container_height,
+          run.num_boids, spawn_options, run.flocking_params));
+}
+
+RunSummary EnsembleRunner::RunOne(
+    const EnsembleRun &run, const visualizer::BoidContainer &swarm) const {
+  visualizer::BoidContainer container(swarm);
+  container.set_flocking_params(run.flocking_params);
+  glm::vec2 mouse_pos(0, 0);
+
+  // Only the last frame is summarized, so the density map is a single cell
+  container.EnableAnalytics(1, 1, 1);
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  for (size_t frame = 0; frame < settings_.num_frames; frame++) {
+    container.AdvanceOnFrame(mouse_pos);
+  }
+
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  RunSummary summary;
+  summary.run = run;
+  summary.ms_per_frame =
+      settings_.num_frames > 0 ? elapsed.count() / settings_.num_frames : 0.0;
+
+  const FrameAnalytics &analytics = container.analytics()->latest();
+  summary.polarization = analytics.polarization;
+  summary.mean_speed = analytics.mean_speed;
+  summary.mean_neighbors = analytics.mean_neighbors;
+  summary.num_flocks = analytics.num_flocks;
+  summary.largest_flock = analytics.largest_flock;
+
+  const std::vector<std::vector<float>> &bounds = container.container_bounds();
+  size_t num_out_of_bounds = 0;
+
+  for (const Boid &boid : container.boids()) {
+    const glm::vec2 &position = boid.position();
+
+    if (position.x < bounds[0][0] || position.x > bounds[0][1] ||
+        position.y < bounds[1][0] || position.y > bounds[1][1]) {
+      num_out_of_bounds++;
+    }
+  }
+
+  summary.out_of_bounds_fraction =
+      num_out_of_bounds / std::max(1.0f, (float)container.boids().size());
+
+  return summary;
+}
+
+} // namespace headless
+
+} // namespace boid_sim
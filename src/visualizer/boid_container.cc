@@ -1,27 +1,117 @@
 //
 // Created by Kaelan Davis on 4/19/2021.
 //
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <random>
 
+#include "cinder/PolyLine.h"
+#include "cinder/gl/VertBatch.h"
+#include "core/checkpoint.h"
 #include "visualizer/boid_container.h"
 
 namespace boid_sim {
 
 namespace visualizer {
 
-BoidContainer::BoidContainer() = default;
+namespace {
+
+// Enough tasks per thread for stealing to even out bad cost estimates
+const size_t kTasksPerThread = 8;
+
+// Past this many dense cells per boid, mostly empty cells cost more than
+// hashing
+const double kMaxDenseCellsPerBoid = 16.0;
+const double kMinDenseCells = 1 << 16;
+
+// Covers rounding in how far a boid moves in one frame
+const float kDisplacementSlack = 1e-3f;
+
+// Sampling the far field keeps every neighbor within this fraction of a
+// boid's vision, and one in every kFarFieldStride of the rest
+const float kNearFieldFraction = 0.5f;
+const size_t kFarFieldStride = 4;
+
+// How far past its body a boid's nose is drawn
+const float kNoseRadius = 4.0f;
+
+// Smallest texel of a density texture, in pixels on screen
+const float kDensityTexelPixels = 4.0f;
+
+// Adds a boid at position to the density texel it falls in, if any
+void AddToDensity(const glm::vec2 &position, RenderBatch &batch) {
+  glm::vec2 texel = (position - batch.density_origin) / batch.density_cell_size;
+
+  if (texel.x >= 0.0f && texel.y >= 0.0f &&
+      texel.x < (float)batch.density_columns &&
+      texel.y < (float)batch.density_rows) {
+    batch.density[(size_t)texel.y * batch.density_columns +
+                  (size_t)texel.x]++;
+  }
+}
+
+// Fewest batched queries in a cell for them to share one sorted list of
+// candidates, below which each query gathers its own
+const size_t kMinSharedQueries = 32;
+
+// Key of the cell of side cell_size that point falls in, which buckets
+// batched queries. Cells too far out to number share a key, which only makes
+// their bucket wider.
+uint64_t QueryCellKey(const glm::vec2 &point, float cell_size) {
+  const float kLimit = 2e9f;
+  float column = std::max(-kLimit, std::min(kLimit, point.x / cell_size));
+  float row = std::max(-kLimit, std::min(kLimit, point.y / cell_size));
+
+  return (uint64_t)(uint32_t)(int32_t)std::floor(row) << 32 |
+         (uint32_t)(int32_t)std::floor(column);
+}
+
+} // namespace
+
+BoidContainer::BoidContainer() { set_num_threads(1); }
 
 BoidContainer::BoidContainer(size_t display_window_width,
                              size_t display_window_height, size_t num_boids)
     : num_boids_(num_boids) {
+  set_num_threads(1);
+
+  // One read from the entropy source seeds the whole swarm
+  std::random_device rd;
+  SpawnOptions spawn_options;
+  spawn_options.seed = ((uint64_t)rd() << 32) | rd();
+
   SetContainerBounds(display_window_width, display_window_height);
-  PopulateBoids();
+  PopulateBoids(spawn_options);
 }
 
+BoidContainer::BoidContainer(size_t display_window_width,
+                             size_t display_window_height, size_t num_boids,
+                             const SpawnOptions &spawn_options,
+                             const FlockingParams &flocking_params)
+    : num_boids_(num_boids), flocking_params_(flocking_params) {
+  set_num_threads(1);
+  SetContainerBounds(display_window_width, display_window_height);
+  PopulateBoids(spawn_options);
+}
+
+BoidContainer::BoidContainer(const BoidContainer &source) { *this = source; }
+
 BoidContainer &BoidContainer::operator=(const BoidContainer &source) {
   boids_ = source.boids_;
   container_bounds_ = source.container_bounds_;
   num_boids_ = source.num_boids_;
+  flocking_params_ = source.flocking_params_;
+  rng_ = source.rng_;
+  set_num_threads(source.num_threads_);
+  deterministic_ = source.deterministic_;
+  unbounded_ = source.unbounded_;
+  num_predators_ = source.num_predators_;
+  obstacle_field_ = source.obstacle_field_;
+  fidelity_ = source.fidelity_;
+  index_valid_ = false;
+  frame_count_ = source.frame_count_;
+  neighbor_counts_ = source.neighbor_counts_;
 
   return *this;
 }
@@ -35,39 +125,981 @@ void BoidContainer::SetContainerBounds(size_t display_window_width,
 }
 
 void BoidContainer::Display() {
+  DrawObstacles();
+
   for (Boid &boid : boids_) {
     boid.Draw();
   }
 }
 
-void BoidContainer::PopulateBoids() {
-  for (size_t i = 0; i < num_boids_; i++) {
-    glm::vec2 start_position = GenerateRandomPosition();
-    glm::vec2 start_direction = GenerateRandomDirection();
+void BoidContainer::Display(const Camera2D &camera) {
+  DrawObstacles();
+  CullForCamera(camera, render_batch_);
+
+  if (render_batch_.detail == RenderDetail::kTriangles) {
+    for (size_t index : render_batch_.boids) {
+      boids_[index].Draw();
+    }
+  } else if (render_batch_.detail == RenderDetail::kPoints) {
+    ci::gl::VertBatch points(GL_POINTS);
+
+    for (size_t index : render_batch_.boids) {
+      if (boids_[index].role() == BoidRole::kPredator) {
+        points.color(ci::Color("OrangeRed"));
+      } else {
+        points.color(ci::Color("MediumAquamarine"));
+      }
+
+      points.vertex(boids_[index].position());
+    }
+
+    points.draw();
+  } else {
+    DrawDensity();
+  }
+}
+
+void BoidContainer::CullForCamera(const Camera2D &camera,
+                                  RenderBatch &batch) const {
+  glm::vec2 min_corner;
+  glm::vec2 max_corner;
+  camera.VisibleRect(min_corner, max_corner);
+
+  // A boid just off screen can still poke its body and nose into view
+  float body_radius = boids_.empty() ? 0.0f : boids_.front().body_radius();
+  glm::vec2 margin(body_radius + kNoseRadius, body_radius + kNoseRadius);
+  min_corner -= margin;
+  max_corner += margin;
+
+  batch.detail = camera.DetailFor(body_radius);
+  batch.boids.clear();
+  batch.density.clear();
+  batch.density_columns = 0;
+  batch.density_rows = 0;
+
+  if (batch.detail == RenderDetail::kDensity) {
+    CountDensity(min_corner, max_corner,
+                 kDensityTexelPixels / camera.zoom(), batch);
+  } else {
+    QueryRect(min_corner, max_corner, batch.boids);
+  }
+}
+
+const RenderBatch &BoidContainer::render_batch() const {
+  return render_batch_;
+}
 
-    float boid_speed = 2.0f;
-    Boid boid(i, start_position, start_direction, boid_speed);
+void BoidContainer::DrawObstacles() {
+  if (obstacle_field_) {
+    ci::gl::color(ci::Color("DimGray"));
 
-    boids_.push_back(boid);
+    for (const std::vector<glm::vec2> &obstacle :
+         obstacle_field_->obstacles()) {
+      ci::PolyLine2f outline(obstacle);
+      outline.setClosed();
+      ci::gl::drawSolid(outline);
+    }
+  }
+}
+
+void BoidContainer::DrawDensity() {
+  const RenderBatch &batch = render_batch_;
+  if (batch.density.empty()) {
+    return;
+  }
+
+  int32_t columns = (int32_t)batch.density_columns;
+  int32_t rows = (int32_t)batch.density_rows;
+  if (density_channel_.getWidth() != columns ||
+      density_channel_.getHeight() != rows) {
+    density_channel_ = ci::Channel8u(columns, rows);
+    density_texture_.reset();
+  }
+
+  // The densest texel on screen is drawn at full brightness
+  uint32_t max_count = std::max<uint32_t>(
+      1, *std::max_element(batch.density.begin(), batch.density.end()));
+
+  for (int32_t row = 0; row < rows; row++) {
+    for (int32_t column = 0; column < columns; column++) {
+      uint32_t count = batch.density[row * columns + column];
+      density_channel_.setValue(glm::ivec2(column, row),
+                                (uint8_t)(255 * (uint64_t)count / max_count));
+    }
+  }
+
+  // The texture is only reallocated when the view changes size
+  if (density_texture_) {
+    density_texture_->update(density_channel_);
+  } else {
+    density_texture_ = ci::gl::Texture2d::create(density_channel_);
+  }
+
+  glm::vec2 size((float)columns * batch.density_cell_size,
+                 (float)rows * batch.density_cell_size);
+  ci::gl::color(ci::Color("MediumAquamarine"));
+  ci::gl::draw(density_texture_,
+               ci::Rectf(batch.density_origin, batch.density_origin + size));
+}
+
+void BoidContainer::CountDensity(const glm::vec2 &min_corner,
+                                 const glm::vec2 &max_corner,
+                                 float texel_size, RenderBatch &batch) const {
+  bool indexed = index_valid_ && !use_sparse_grid_ &&
+                 positions_.size() + predator_positions_.size() ==
+                     boids_.size();
+
+  if (indexed) {
+    /*
+     * Every texel covers a square block of grid cells, so the counts the
+     * grid already keeps add up to the texels. The counts are from the
+     * positions the last frame started with, at most a step behind.
+     */
+    size_t columns = grid_.columns();
+    size_t min_cell = grid_.CellOf(min_corner);
+    size_t max_cell = grid_.CellOf(max_corner);
+    size_t min_column = min_cell % columns;
+    size_t min_row = min_cell / columns;
+    size_t max_column = max_cell % columns;
+    size_t max_row = max_cell / columns;
+    size_t stride = std::max<size_t>(
+        1, (size_t)std::ceil(texel_size / grid_.cell_size()));
+
+    batch.density_origin =
+        grid_.origin() +
+        glm::vec2((float)min_column, (float)min_row) * grid_.cell_size();
+    batch.density_cell_size = (float)stride * grid_.cell_size();
+    batch.density_columns = (max_column - min_column) / stride + 1;
+    batch.density_rows = (max_row - min_row) / stride + 1;
+    batch.density.assign(batch.density_columns * batch.density_rows, 0);
+
+    const std::vector<size_t> &cell_starts = grid_.cell_starts();
+    for (size_t row = min_row; row <= max_row; row++) {
+      for (size_t column = min_column; column <= max_column; column++) {
+        size_t cell = row * columns + column;
+        size_t texel = (row - min_row) / stride * batch.density_columns +
+                       (column - min_column) / stride;
+        batch.density[texel] +=
+            (uint32_t)(cell_starts[cell + 1] - cell_starts[cell]);
+      }
+    }
+
+    // The few predators are binned one by one
+    for (size_t index = positions_.size(); index < boids_.size(); index++) {
+      AddToDensity(boids_[index].position(), batch);
+    }
+
+    return;
+  }
+
+  // Sparse cells are not laid out in rows, so the boids in view are binned
+  batch.density_cell_size = texel_size;
+  batch.density_origin =
+      glm::vec2(std::floor(min_corner.x / texel_size),
+                std::floor(min_corner.y / texel_size)) *
+      texel_size;
+  batch.density_columns =
+      (size_t)((max_corner.x - batch.density_origin.x) / texel_size) + 1;
+  batch.density_rows =
+      (size_t)((max_corner.y - batch.density_origin.y) / texel_size) + 1;
+  batch.density.assign(batch.density_columns * batch.density_rows, 0);
+
+  QueryRect(min_corner, max_corner, batch.boids);
+  for (size_t index : batch.boids) {
+    AddToDensity(boids_[index].position(), batch);
+  }
+
+  batch.boids.clear();
+}
+
+void BoidContainer::PopulateBoids(const SpawnOptions &spawn_options) {
+  rng_ = SwarmRng(spawn_options.seed);
+
+  SpawnSwarm(container_bounds_, num_boids_, spawn_options,
+             flocking_params_.max_speed, flocking_params_.fov_radius, rng_,
+             boids_);
+
+  for (Boid &boid : boids_) {
+    boid.set_view_angle(flocking_params_.view_angle);
+  }
+
+  num_predators_ = 0;
+}
+
+void BoidContainer::AddPredators(size_t num_predators) {
+  size_t first = boids_.size();
+  SpawnSwarm(container_bounds_, num_predators, SpawnOptions(),
+             flocking_params_.predator_max_speed, flocking_params_.fov_radius,
+             rng_, boids_);
+
+  for (size_t i = first; i < boids_.size(); i++) {
+    boids_[i].set_role(BoidRole::kPredator);
+    boids_[i].set_view_angle(flocking_params_.view_angle);
+  }
+
+  num_boids_ = boids_.size();
+  num_predators_ += num_predators;
+  index_valid_ = false;
+}
+
+size_t BoidContainer::num_predators() const { return num_predators_; }
+
+void BoidContainer::PartitionRoles() {
+  // Keeping each role together lets its index map back to boids by an offset
+  std::stable_partition(boids_.begin(), boids_.end(), [](const Boid &boid) {
+    return boid.role() == BoidRole::kPrey;
+  });
+
+  num_predators_ = 0;
+  for (const Boid &boid : boids_) {
+    if (boid.role() == BoidRole::kPredator) {
+      num_predators_++;
+    }
   }
 }
 
 void BoidContainer::AdvanceOnFrame(glm::vec2 &mouse_pos) {
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  size_t substeps = std::max<size_t>(1, fidelity_.substeps);
+  for (size_t substep = 0; substep < substeps; substep++) {
+    // Analytics only measure where the frame ends up
+    Substep(mouse_pos, 1.0f / (float)substeps, substep + 1 == substeps);
+
+    // Nothing a substep took from the arena outlives it
+    arena_.Reset();
+  }
+
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  last_step_ms_ = elapsed.count();
+
+  if (frame_budget_) {
+    fidelity_ = frame_budget_->Update(last_step_ms_);
+  }
+
+  frame_count_++;
+
+  if (state_writer_) {
+    PublishState();
+  }
+}
+
+void BoidContainer::Substep(glm::vec2 &mouse_pos, float time_step,
+                            bool measure) {
   /*
    * All calculations for all boids use this "snapshot" of time.
    *  So updated boids don't affect calculations of boids that still
    *  need to be updated.
    */
 
-  std::vector<Boid> boid_snapshot = boids_;
+  ArenaVector<Boid> boid_snapshot(boids_.begin(), boids_.end(),
+                                  ArenaAllocator<Boid>(&arena_));
+  size_t num_prey = boid_snapshot.size() - num_predators_;
 
-  float align_percent = .30f;
-  float cohesion_percent = .95f;
-  float separation_percent = 1.0f;
+  positions_.resize(num_prey);
+  predator_positions_.resize(num_predators_);
+  float max_fov_radius = 0.0f;
+  float max_predator_radius = flocking_params_.flee_radius;
+  float max_speed = 0.0f;
 
-  for (Boid &boid : boids_) {
-    boid.UpdatePosition(container_bounds_, boid_snapshot, mouse_pos,
-                        align_percent, cohesion_percent, separation_percent);
+  for (size_t i = 0; i < boid_snapshot.size(); i++) {
+    if (i < num_prey) {
+      positions_[i] = boid_snapshot[i].position();
+      max_fov_radius = std::max(max_fov_radius, boid_snapshot[i].fov_radius());
+    } else {
+      predator_positions_[i - num_prey] = boid_snapshot[i].position();
+      max_predator_radius =
+          std::max(max_predator_radius, boid_snapshot[i].fov_radius());
+    }
+
+    max_speed = std::max(max_speed, boid_snapshot[i].max_speed());
+  }
+
+  // A dense grid over a huge world would be almost all empty cells
+  float cell_size = std::max(1.0f, max_fov_radius);
+  double dense_cells =
+      std::ceil((container_bounds_[0][1] - container_bounds_[0][0]) /
+                cell_size) *
+      std::ceil((container_bounds_[1][1] - container_bounds_[1][0]) /
+                cell_size);
+  use_sparse_grid_ =
+      unbounded_ || dense_cells > kMinDenseCells + kMaxDenseCellsPerBoid *
+                                                       boid_snapshot.size();
+
+  if (use_sparse_grid_) {
+    sparse_grid_.Build(positions_, max_fov_radius);
+  } else {
+    grid_.Build(positions_, container_bounds_, max_fov_radius, num_threads_);
+  }
+
+  // Predators get an index of their own, sized for how far prey spot them
+  if (num_predators_ > 0 && use_sparse_grid_) {
+    predator_sparse_grid_.Build(predator_positions_, max_predator_radius);
+  } else if (num_predators_ > 0) {
+    predator_grid_.Build(predator_positions_, container_bounds_,
+                         max_predator_radius);
+  }
+
+  PlanTasks();
+  neighbor_counts_.resize(boids_.size());
+
+  FlockAnalytics *analytics = measure ? analytics_.get() : nullptr;
+  if (analytics) {
+    analytics->BeginFrame(boids_.size());
+  }
+
+  // Capturing just two pointers lets std::function hold the task without
+  // allocating
+  struct StepState {
+    const ArenaVector<Boid> *boid_snapshot;
+    glm::vec2 *mouse_pos;
+    float time_step;
+    FlockAnalytics *analytics;
+  } step = {&boid_snapshot, &mouse_pos, time_step, analytics};
+
+  scheduler_.Run(task_costs_, [this, &step](size_t task, size_t worker) {
+    for (size_t entry = task_starts_[task]; entry < task_starts_[task + 1];
+         entry++) {
+      UpdateBoid(BoidAtEntry(entry), *step.boid_snapshot, *step.mouse_pos,
+                 step.time_step, step.analytics, candidate_scratch_[worker]);
+    }
+  });
+
+  if (analytics) {
+    analytics->SetFrameBudget(
+        last_step_ms_, frame_budget_ ? frame_budget_->level() : 0, fidelity_);
+    analytics->EndFrame(frame_count_, boid_snapshot, neighbor_counts_,
+                        container_bounds_, num_threads_);
+  }
+
+  // Queries until the next frame use this index, built before boids moved
+  index_valid_ = true;
+  max_displacement_ = max_speed * time_step * (1.0f + kDisplacementSlack);
+}
+
+void BoidContainer::PlanTasks() {
+  /*
+   * Boids are taken in grid order, so every task covers boids that sit close
+   * together. A boid costs about as much as the neighbors it had last frame,
+   * and tasks are cut to even out that cost rather than the boid count, which
+   * splits up dense flocks and lumps together sparse cells. Predators follow
+   * the prey, in the order of their own grid.
+   */
+  size_t num_entries = boids_.size();
+  bool has_counts = neighbor_counts_.size() == num_entries;
+
+  size_t total_cost = 0;
+  for (size_t index = 0; index < num_entries; index++) {
+    total_cost += 1 + (has_counts ? neighbor_counts_[index] : 0);
+  }
+
+  size_t num_tasks = num_threads_ == 1 ? 1 : num_threads_ * kTasksPerThread;
+  size_t task_cost = std::max<size_t>(1, total_cost / num_tasks);
+
+  task_starts_.assign(1, 0);
+  task_costs_.clear();
+  size_t cost = 0;
+
+  for (size_t entry = 0; entry < num_entries; entry++) {
+    cost += 1 + (has_counts ? neighbor_counts_[BoidAtEntry(entry)] : 0);
+
+    if (cost >= task_cost || entry + 1 == num_entries) {
+      task_starts_.push_back(entry + 1);
+      task_costs_.push_back(cost);
+      cost = 0;
+    }
+  }
+}
+
+size_t BoidContainer::BoidAtEntry(size_t entry) const {
+  const std::vector<size_t> &entries =
+      use_sparse_grid_ ? sparse_grid_.entries() : grid_.entries();
+
+  if (entry < entries.size()) {
+    return entries[entry];
+  }
+
+  const std::vector<size_t> &predator_entries =
+      use_sparse_grid_ ? predator_sparse_grid_.entries()
+                       : predator_grid_.entries();
+  return positions_.size() + predator_entries[entry - entries.size()];
+}
+
+const glm::vec2 &BoidContainer::PositionAt(size_t index) const {
+  if (index < positions_.size()) {
+    return positions_[index];
+  }
+
+  return predator_positions_[index - positions_.size()];
+}
+
+void BoidContainer::UpdateBoid(size_t index,
+                               const ArenaVector<Boid> &boid_snapshot,
+                               glm::vec2 &mouse_pos, float time_step,
+                               FlockAnalytics *analytics,
+                               std::vector<size_t> &candidates) {
+  Boid &boid = boids_[index];
+  std::vector<std::vector<float>> no_bounds;
+  std::vector<std::vector<float>> &bounds =
+      unbounded_ ? no_bounds : container_bounds_;
+
+  // Crowded boids only steer on every other frame at a lower level of detail,
+  // keeping their neighbor count so the choice holds still
+  size_t previous_count = neighbor_counts_[index];
+  if (previous_count > fidelity_.lod_neighbor_threshold &&
+      (frame_count_ + index) % 2 == 1) {
+    Boid::NeighborSums no_neighbors;
+
+    if (obstacle_field_) {
+      boid.UpdatePosition(*obstacle_field_, no_neighbors, mouse_pos, 0.0f,
+                          0.0f, 0.0f, glm::vec2(0, 0), time_step);
+    } else {
+      boid.UpdatePosition(bounds, no_neighbors, mouse_pos, 0.0f, 0.0f, 0.0f,
+                          glm::vec2(0, 0), time_step);
+    }
+
+    return;
+  }
+
+  VisionCone cone = boid.vision_cone();
+  bool sample_far_field =
+      previous_count > fidelity_.far_field_neighbor_threshold;
+  float near_radius = boid.fov_radius() * kNearFieldFraction;
+
+  // Boids only flock with their own role
+  GatherRole(index >= positions_.size(), boid.position(), boid.fov_radius(),
+             &cone, candidates);
+
+  // Only boids that can actually be seen are worth copying and ordering
+  size_t num_visible = 0;
+  size_t num_kept = 0;
+  for (size_t candidate : candidates) {
+    const glm::vec2 &position = PositionAt(candidate);
+    float distance = glm::distance(boid.position(), position);
+
+    if (distance < boid.fov_radius() && cone.Contains(position)) {
+      num_visible++;
+
+      if (!sample_far_field || distance < near_radius ||
+          candidate % kFarFieldStride == index % kFarFieldStride) {
+        candidates[num_kept++] = candidate;
+      }
+    }
+  }
+  candidates.resize(num_kept);
+
+  neighbor_counts_[index] = num_visible > 0 ? num_visible - 1 : 0;
+
+  // The boid itself is among its candidates
+  if (!candidates.empty() &&
+      fidelity_.max_neighbors < candidates.size() - 1) {
+    CapNeighbors(index, candidates);
+  }
+
+  if (analytics) {
+    analytics->Link(index, candidates);
+  }
+
+  if (deterministic_) {
+    // Threaded grid builds fill cells in any order, so restore id order
+    std::sort(candidates.begin(), candidates.end());
+  }
+
+  // Summed straight from the snapshot, in the same order and with the same
+  // checks Boid would apply to a copied out list of them
+  Boid::NeighborSums sums;
+  for (size_t candidate : candidates) {
+    const Boid &neighbor = boid_snapshot[candidate];
+
+    if (boid != neighbor) {
+      boid.AddNeighbor(neighbor.position(), neighbor.velocity(), sums);
+    }
+  }
+
+  glm::vec2 external_force(0, 0);
+  if (num_predators_ > 0) {
+    external_force = SteerAcrossRoles(index, candidates);
+  }
+
+  if (obstacle_field_) {
+    boid.UpdatePosition(*obstacle_field_, sums, mouse_pos,
+                        flocking_params_.align_percent,
+                        flocking_params_.cohesion_percent,
+                        flocking_params_.separation_percent, external_force,
+                        time_step);
+    return;
+  }
+
+  boid.UpdatePosition(bounds, sums, mouse_pos,
+                      flocking_params_.align_percent,
+                      flocking_params_.cohesion_percent,
+                      flocking_params_.separation_percent, external_force,
+                      time_step);
+}
+
+void BoidContainer::CapNeighbors(size_t index,
+                                 std::vector<size_t> &candidates) const {
+  // Keep the boid and its nearest neighbors, breaking ties by index so the
+  // same neighbors are kept for any thread count
+  const glm::vec2 &position = PositionAt(index);
+  size_t num_kept = fidelity_.max_neighbors + 1;
+
+  std::nth_element(candidates.begin(), candidates.begin() + num_kept - 1,
+                   candidates.end(), [&](size_t boid1, size_t boid2) {
+                     float distance1 =
+                         glm::distance(position, PositionAt(boid1));
+                     float distance2 =
+                         glm::distance(position, PositionAt(boid2));
+
+                     return distance1 < distance2 ||
+                            (distance1 == distance2 && boid1 < boid2);
+                   });
+  candidates.resize(num_kept);
+}
+
+glm::vec2 BoidContainer::SteerAcrossRoles(size_t index,
+                                          std::vector<size_t> &candidates) {
+  Boid &boid = boids_[index];
+  bool is_predator = index >= positions_.size();
+  float radius = is_predator ? flocking_params_.hunt_radius
+                             : flocking_params_.flee_radius;
+
+  // Prey only search the small predator index, and predators only the prey
+  // cells within their hunting radius
+  GatherRole(!is_predator, boid.position(), radius, nullptr, candidates);
+
+  size_t nearest = boids_.size();
+  float nearest_distance = radius;
+
+  for (size_t candidate : candidates) {
+    float distance = glm::distance(boid.position(), PositionAt(candidate));
+
+    if (distance < nearest_distance ||
+        (distance == nearest_distance && candidate < nearest)) {
+      nearest = candidate;
+      nearest_distance = distance;
+    }
+  }
+
+  if (nearest == boids_.size()) {
+    return glm::vec2(0, 0);
+  }
+
+  return is_predator ? boid.Pursue(PositionAt(nearest))
+                     : boid.Flee(PositionAt(nearest));
+}
+
+void BoidContainer::GatherRole(bool predators, const glm::vec2 &center,
+                               float radius, const VisionCone *cone,
+                               std::vector<size_t> &indices) const {
+  const SpatialGrid &grid = predators ? predator_grid_ : grid_;
+  const SparseGrid &sparse_grid =
+      predators ? predator_sparse_grid_ : sparse_grid_;
+
+  if (use_sparse_grid_ && cone != nullptr) {
+    sparse_grid.Gather(center, radius, *cone, indices);
+  } else if (use_sparse_grid_) {
+    sparse_grid.Gather(center, radius, indices);
+  } else if (cone != nullptr) {
+    grid.Gather(center, radius, *cone, indices);
+  } else {
+    grid.Gather(center, radius, indices);
+  }
+
+  if (predators) {
+    for (size_t &index : indices) {
+      index += positions_.size();
+    }
+  }
+}
+
+void BoidContainer::set_num_threads(size_t num_threads) {
+  num_threads_ = std::max<size_t>(1, num_threads);
+  scheduler_.set_num_workers(num_threads_);
+  candidate_scratch_.resize(num_threads_);
+}
+
+size_t BoidContainer::num_threads() const { return num_threads_; }
+
+void BoidContainer::set_deterministic(bool deterministic) {
+  deterministic_ = deterministic;
+}
+
+bool BoidContainer::is_deterministic() const { return deterministic_; }
+
+void BoidContainer::set_unbounded(bool unbounded) { unbounded_ = unbounded; }
+
+bool BoidContainer::is_unbounded() const { return unbounded_; }
+
+bool BoidContainer::uses_sparse_grid() const { return use_sparse_grid_; }
+
+void BoidContainer::LoadObstacles(const std::string &path, float cell_size) {
+  SetObstacles(ReadObstacles(path), cell_size);
+}
+
+void BoidContainer::SetObstacles(
+    const std::vector<std::vector<glm::vec2>> &obstacles, float cell_size) {
+  std::shared_ptr<ObstacleField> obstacle_field(new ObstacleField());
+  obstacle_field->Bake(obstacles, container_bounds_, cell_size, !unbounded_);
+  obstacle_field_ = obstacle_field;
+}
+
+void BoidContainer::ClearObstacles() { obstacle_field_.reset(); }
+
+const ObstacleField *BoidContainer::obstacle_field() const {
+  return obstacle_field_.get();
+}
+
+void BoidContainer::set_fidelity(const FidelitySettings &fidelity) {
+  fidelity_ = fidelity;
+}
+
+const FidelitySettings &BoidContainer::fidelity() const { return fidelity_; }
+
+void BoidContainer::EnableFrameBudget(double target_ms, size_t max_substeps) {
+  frame_budget_.reset(new FrameBudgetController(target_ms, max_substeps));
+  fidelity_ = frame_budget_->settings();
+}
+
+void BoidContainer::DisableFrameBudget() {
+  frame_budget_.reset();
+  fidelity_ = FidelitySettings();
+}
+
+const FrameBudgetController *BoidContainer::frame_budget() const {
+  return frame_budget_.get();
+}
+
+double BoidContainer::last_step_ms() const { return last_step_ms_; }
+
+size_t BoidContainer::scratch_high_water_mark() const {
+  return arena_.high_water_mark();
+}
+
+void BoidContainer::EnableAnalytics(size_t density_columns,
+                                    size_t density_rows,
+                                    size_t buffer_capacity) {
+  analytics_.reset(
+      new FlockAnalytics(density_columns, density_rows, buffer_capacity));
+}
+
+void BoidContainer::DisableAnalytics() { analytics_.reset(); }
+
+FlockAnalytics *BoidContainer::analytics() { return analytics_.get(); }
+
+void BoidContainer::EnableStateExport(const std::string &name,
+                                      size_t num_slots) {
+  // The old writer has to let go of the name before a new one takes it
+  state_writer_.reset();
+  state_writer_.reset(new SharedStateWriter(name, boids_.size(), num_slots));
+}
+
+void BoidContainer::DisableStateExport() { state_writer_.reset(); }
+
+const SharedStateWriter *BoidContainer::state_writer() const {
+  return state_writer_.get();
+}
+
+void BoidContainer::PublishState() {
+  if (boids_.size() > state_writer_->capacity()) {
+    std::string name = state_writer_->name();
+    size_t num_slots = state_writer_->num_slots();
+    state_writer_.reset();
+    state_writer_.reset(new SharedStateWriter(name, boids_.size(), num_slots));
+  }
+
+  state_writer_->Publish(frame_count_, container_bounds_, boids_);
+}
+
+size_t BoidContainer::frame_count() const { return frame_count_; }
+
+const std::vector<size_t> &BoidContainer::neighbor_counts() const {
+  return neighbor_counts_;
+}
+
+void BoidContainer::QueryRadius(const glm::vec2 &center, float radius,
+                                std::vector<size_t> &indices) const {
+  GatherIndexed(center, radius, indices);
+
+  size_t num_found = 0;
+  for (size_t index : indices) {
+    if (glm::distance(boids_[index].position(), center) <= radius) {
+      indices[num_found++] = index;
+    }
+  }
+
+  indices.resize(num_found);
+  std::sort(indices.begin(), indices.end());
+}
+
+void BoidContainer::QueryRect(const glm::vec2 &min_corner,
+                              const glm::vec2 &max_corner,
+                              std::vector<size_t> &indices) const {
+  glm::vec2 center = (min_corner + max_corner) * 0.5f;
+  float half_extent = std::max(max_corner.x - min_corner.x,
+                               max_corner.y - min_corner.y) *
+                      0.5f;
+  GatherIndexed(center, std::max(0.0f, half_extent), indices);
+
+  size_t num_found = 0;
+  for (size_t index : indices) {
+    const glm::vec2 &position = boids_[index].position();
+
+    if (position.x >= min_corner.x && position.x <= max_corner.x &&
+        position.y >= min_corner.y && position.y <= max_corner.y) {
+      indices[num_found++] = index;
+    }
+  }
+
+  indices.resize(num_found);
+  std::sort(indices.begin(), indices.end());
+}
+
+size_t BoidContainer::QueryNearest(const glm::vec2 &point,
+                                   std::vector<size_t> &scratch) const {
+  size_t nearest = boids_.size();
+  float radius = std::max(1.0f, use_sparse_grid_ ? sparse_grid_.cell_size()
+                                                 : grid_.cell_size());
+
+  while (!boids_.empty()) {
+    /*
+     * A boid closer than radius is sure to be in the gathered cells, so the
+     * best candidate is the answer once it is that close. Otherwise widen the
+     * search until it is, or until every boid was a candidate.
+     */
+    GatherIndexed(point, radius, scratch);
+
+    float nearest_distance = 0.0f;
+    for (size_t index : scratch) {
+      float distance = glm::distance(boids_[index].position(), point);
+
+      if (nearest == boids_.size() || distance < nearest_distance ||
+          (distance == nearest_distance && index < nearest)) {
+        nearest = index;
+        nearest_distance = distance;
+      }
+    }
+
+    if ((nearest != boids_.size() && nearest_distance <= radius) ||
+        scratch.size() == boids_.size()) {
+      break;
+    }
+
+    nearest = boids_.size();
+    radius *= 2.0f;
+  }
+
+  return nearest;
+}
+
+void BoidContainer::QueryNearest(const std::vector<glm::vec2> &points,
+                                 std::vector<size_t> &nearest,
+                                 QueryScratch &scratch) const {
+  nearest.resize(points.size());
+
+  if (!IsCrowded(points)) {
+    for (size_t query = 0; query < points.size(); query++) {
+      nearest[query] = QueryNearest(points[query], scratch.gathered);
+    }
+
+    return;
+  }
+
+  BucketQueries(points, scratch);
+
+  float radius = std::max(1.0f, use_sparse_grid_ ? sparse_grid_.cell_size()
+                                                 : grid_.cell_size());
+
+  for (size_t begin = 0; begin < points.size();) {
+    glm::vec2 bucket_center;
+    float reach;
+    size_t end = BucketEnd(points, scratch, begin, bucket_center, reach);
+
+    if (end - begin < kMinSharedQueries) {
+      // Too few queries to pay for sorting candidates they would share
+      for (size_t position = begin; position < end; position++) {
+        size_t query = scratch.buckets[position].second;
+        nearest[query] = QueryNearest(points[query], scratch.gathered);
+      }
+
+      begin = end;
+      continue;
+    }
+
+    GatherIndexed(bucket_center, reach + radius, scratch.gathered);
+    SortCandidates(scratch);
+
+    for (size_t position = begin; position < end; position++) {
+      size_t query = scratch.buckets[position].second;
+      float nearest_distance;
+      nearest[query] = NearestCandidate(scratch.candidates, points[query],
+                                        nearest_distance);
+
+      // Every boid within radius of the point is a candidate, so a candidate
+      // that close is the answer. Otherwise search further on its own.
+      if ((nearest[query] == boids_.size() || nearest_distance > radius) &&
+          scratch.candidates.size() != boids_.size()) {
+        nearest[query] = QueryNearest(points[query], scratch.gathered);
+      }
+    }
+
+    begin = end;
+  }
+}
+
+size_t BoidContainer::NearestCandidate(
+    const std::vector<QueryScratch::Candidate> &candidates,
+    const glm::vec2 &point, float &nearest_distance) const {
+  size_t nearest = boids_.size();
+  auto consider = [&](const QueryScratch::Candidate &candidate) {
+    float distance = glm::distance(candidate.position, point);
+
+    if (nearest == boids_.size() || distance < nearest_distance ||
+        (distance == nearest_distance && candidate.index < nearest)) {
+      nearest = candidate.index;
+      nearest_distance = distance;
+    }
+  };
+
+  size_t start =
+      std::partition_point(candidates.begin(), candidates.end(),
+                           [&](const QueryScratch::Candidate &candidate) {
+                             return candidate.position.y < point.y;
+                           }) -
+      candidates.begin();
+
+  /*
+   * Walks out from the row of the point in both directions. A candidate is
+   * at least as far away as its distance in y, so each direction stops once
+   * that alone is further than the nearest candidate so far.
+   */
+  for (size_t i = start; i < candidates.size(); i++) {
+    if (nearest != boids_.size() &&
+        candidates[i].position.y - point.y > nearest_distance) {
+      break;
+    }
+
+    consider(candidates[i]);
+  }
+
+  for (size_t i = start; i-- > 0;) {
+    if (nearest != boids_.size() &&
+        point.y - candidates[i].position.y > nearest_distance) {
+      break;
+    }
+
+    consider(candidates[i]);
+  }
+
+  return nearest;
+}
+
+bool BoidContainer::IsCrowded(const std::vector<glm::vec2> &points) const {
+  if (points.size() < kMinSharedQueries) {
+    return false;
+  } else if (!IsIndexed()) {
+    // Every query would scan every boid, so sharing them always pays
+    return true;
+  }
+
+  glm::vec2 min_corner = points.front();
+  glm::vec2 max_corner = min_corner;
+  for (const glm::vec2 &point : points) {
+    min_corner = glm::min(min_corner, point);
+    max_corner = glm::max(max_corner, point);
+  }
+
+  // Guesses how many queries a cell gets as if they were spread evenly
+  glm::vec2 extent = max_corner - min_corner;
+  double cell_size =
+      use_sparse_grid_ ? sparse_grid_.cell_size() : grid_.cell_size();
+  double num_cells = (std::floor(extent.x / cell_size) + 1) *
+                     (std::floor(extent.y / cell_size) + 1);
+
+  return (double)points.size() >= kMinSharedQueries * num_cells;
+}
+
+void BoidContainer::BucketQueries(const std::vector<glm::vec2> &points,
+                                  QueryScratch &scratch) const {
+  // Every boid is a candidate anyway when nothing is indexed, so then all
+  // queries are one bucket
+  bool indexed = IsIndexed();
+  float cell_size =
+      use_sparse_grid_ ? sparse_grid_.cell_size() : grid_.cell_size();
+
+  scratch.buckets.resize(points.size());
+  for (size_t query = 0; query < points.size(); query++) {
+    uint64_t key = indexed ? QueryCellKey(points[query], cell_size) : 0;
+    scratch.buckets[query] = std::make_pair(key, query);
+  }
+
+  std::sort(scratch.buckets.begin(), scratch.buckets.end());
+}
+
+size_t BoidContainer::BucketEnd(const std::vector<glm::vec2> &points,
+                                const QueryScratch &scratch, size_t begin,
+                                glm::vec2 &center, float &reach) const {
+  const std::vector<std::pair<uint64_t, size_t>> &buckets = scratch.buckets;
+  glm::vec2 min_corner = points[buckets[begin].second];
+  glm::vec2 max_corner = min_corner;
+
+  size_t end = begin + 1;
+  for (; end < buckets.size() && buckets[end].first == buckets[begin].first;
+       end++) {
+    min_corner = glm::min(min_corner, points[buckets[end].second]);
+    max_corner = glm::max(max_corner, points[buckets[end].second]);
+  }
+
+  // A disk around the middle of the bucket that reaches every one of its
+  // points, widened by the query radius, covers all of their queries
+  center = (min_corner + max_corner) * 0.5f;
+  reach = glm::distance(center, max_corner) + kDisplacementSlack;
+
+  return end;
+}
+
+void BoidContainer::SortCandidates(QueryScratch &scratch) const {
+  // Every query of a bucket reads the same candidates, so their positions are
+  // copied next to each other once, in rows, instead of read out of each boid
+  scratch.candidates.resize(scratch.gathered.size());
+  for (size_t i = 0; i < scratch.gathered.size(); i++) {
+    size_t index = scratch.gathered[i];
+    scratch.candidates[i].position = boids_[index].position();
+    scratch.candidates[i].index = index;
+  }
+
+  std::sort(scratch.candidates.begin(), scratch.candidates.end(),
+            [](const QueryScratch::Candidate &candidate1,
+               const QueryScratch::Candidate &candidate2) {
+              return candidate1.position.y < candidate2.position.y;
+            });
+}
+
+bool BoidContainer::IsIndexed() const {
+  return index_valid_ &&
+         positions_.size() + predator_positions_.size() == boids_.size();
+}
+
+void BoidContainer::GatherIndexed(const glm::vec2 &center, float radius,
+                                  std::vector<size_t> &indices) const {
+  if (!IsIndexed()) {
+    // Nothing indexed these boids yet, so every boid is a candidate
+    indices.resize(boids_.size());
+    for (size_t index = 0; index < boids_.size(); index++) {
+      indices[index] = index;
+    }
+
+    return;
+  }
+
+  // Boids moved since the index was built, so look a step further out
+  GatherRole(false, center, radius + max_displacement_, nullptr, indices);
+
+  // There are few enough predators for all of them to be candidates
+  for (size_t index = positions_.size(); index < boids_.size(); index++) {
+    indices.push_back(index);
   }
 }
 
@@ -83,25 +1115,32 @@ void BoidContainer::DefaultBehavior() {
   }
 }
 
-glm::vec2 BoidContainer::GenerateRandomDirection() {
-  std::random_device rd;
-  std::uniform_real_distribution<float> direction_distribution(-1.f, 1.f);
-
-  // Vector with velocity 1 and random direction
-  glm::vec2 normalized_random_direction = glm::normalize(
-      glm::vec2(direction_distribution(rd), direction_distribution(rd)));
+void BoidContainer::SaveCheckpoint(const std::string &path) const {
+  CheckpointState state;
+  state.container_bounds = container_bounds_;
+  state.unbounded = unbounded_;
+  state.flocking_params = flocking_params_;
+  state.fidelity = fidelity_;
+  state.rng = rng_;
+  state.frame_count = frame_count_;
 
-  return normalized_random_direction;
+  WriteCheckpoint(path, state, boids_, neighbor_counts_);
 }
 
-glm::vec2 BoidContainer::GenerateRandomPosition() {
-  std::random_device rd;
-  std::uniform_real_distribution<float> x_bounds_distribution(
-      container_bounds_[0][0], container_bounds_[0][1]);
-  std::uniform_real_distribution<float> y_bounds_distribution(
-      container_bounds_[1][0], container_bounds_[1][1]);
+void BoidContainer::RestoreCheckpoint(const std::string &path) {
+  CheckpointState state;
+  ReadCheckpoint(path, state, boids_, neighbor_counts_);
+
+  container_bounds_ = state.container_bounds;
+  unbounded_ = state.unbounded;
+  flocking_params_ = state.flocking_params;
+  fidelity_ = state.fidelity;
+  rng_ = state.rng;
+  frame_count_ = state.frame_count;
 
-  return glm::vec2(x_bounds_distribution(rd), y_bounds_distribution(rd));
+  PartitionRoles();
+  num_boids_ = boids_.size();
+  index_valid_ = false;
 }
 
 const std::vector<boid_sim::Boid> &BoidContainer::boids() const {
@@ -109,8 +1148,25 @@ const std::vector<boid_sim::Boid> &BoidContainer::boids() const {
 }
 void BoidContainer::set_boids(const std::vector<boid_sim::Boid> &boids) {
   boids_ = boids;
+  PartitionRoles();
+  index_valid_ = false;
 }
 
+const std::vector<std::vector<float>> &
+BoidContainer::container_bounds() const {
+  return container_bounds_;
+}
+
+const FlockingParams &BoidContainer::flocking_params() const {
+  return flocking_params_;
+}
+
+void BoidContainer::set_flocking_params(const FlockingParams &flocking_params) {
+  flocking_params_ = flocking_params;
+}
+
+const SwarmRng &BoidContainer::rng() const { return rng_; }
+
 } // namespace visualizer
 
 } // namespace boid_sim
@@ -1,6 +1,10 @@
 //
 // Created by Kaelan Davis on 4/19/2021.
 //
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
 #include "visualizer/boid_sim_app.h"
 #include "cinder/app/MouseEvent.h"
 
@@ -11,24 +15,57 @@ namespace visualizer {
 BoidSimApp::BoidSimApp() {
   ci::app::setWindowSize(kWindowWidth, kWindowHeight);
   boid_container_ = BoidContainer(kWindowWidth, kWindowHeight, kNumBoids);
+  boid_container_.EnableAnalytics(kDensityColumns, kDensityRows);
+  boid_container_.EnableFrameBudget(kTargetFrameMs, kMaxSubsteps);
+  ResetCamera();
 }
 
 void BoidSimApp::draw() {
   ci::gl::clear(ci::Color("Black"));
-  boid_container_.Display();
+
+  {
+    // Boids are drawn in world coordinates, the camera maps them to pixels
+    ci::gl::ScopedModelMatrix scoped_model;
+    ci::gl::translate(camera_.WorldToScreen(glm::vec2(0, 0)));
+    ci::gl::scale(glm::vec2(camera_.zoom(), camera_.zoom()));
+    boid_container_.Display(camera_);
+  }
+
+  DrawAnalytics();
 }
 
-void BoidSimApp::update() { boid_container_.AdvanceOnFrame(kMousePos); }
+void BoidSimApp::update() {
+  boid_container_.AdvanceOnFrame(kMousePos);
 
-void BoidSimApp::mouseDrag(ci::app::MouseEvent event) { mouseMove(event); }
+  // Only the newest frame is shown, older ones are just drained
+  while (boid_container_.analytics()->buffer().Pop(frame_analytics_)) {
+  }
+}
+
+void BoidSimApp::mouseDrag(ci::app::MouseEvent event) {
+  if (event.isRightDown()) {
+    glm::vec2 position = event.getPos();
+    camera_.Pan(position - pan_start_);
+    pan_start_ = position;
+  }
+
+  mouseMove(event);
+}
 
 void BoidSimApp::mouseMove(ci::app::MouseEvent event) {
-  kMousePos = event.getPos();
+  kMousePos = camera_.ScreenToWorld(event.getPos());
+}
+
+void BoidSimApp::mouseWheel(ci::app::MouseEvent event) {
+  camera_.ZoomAt(event.getPos(),
+                 std::pow(kZoomStep, event.getWheelIncrement()));
 }
 
 void BoidSimApp::mouseDown(ci::app::MouseEvent event) {
   if (event.isLeft()) {
     boid_container_.SeekMouse();
+  } else if (event.isRight()) {
+    pan_start_ = event.getPos();
   }
 }
 void BoidSimApp::mouseUp(ci::app::MouseEvent event) {
@@ -37,6 +74,52 @@ void BoidSimApp::mouseUp(ci::app::MouseEvent event) {
   }
 }
 
+void BoidSimApp::keyDown(ci::app::KeyEvent event) {
+  if (event.getCode() == ci::app::KeyEvent::KEY_p) {
+    boid_container_.AddPredators(1);
+  } else if (event.getCode() == ci::app::KeyEvent::KEY_r) {
+    ResetCamera();
+  } else if (event.getCode() == ci::app::KeyEvent::KEY_e) {
+    if (boid_container_.state_writer() == nullptr) {
+      boid_container_.EnableStateExport(kStateExportName);
+    } else {
+      boid_container_.DisableStateExport();
+    }
+  }
+}
+
+void BoidSimApp::resize() {
+  camera_.set_viewport_size(ci::app::getWindowSize());
+}
+
+void BoidSimApp::DrawAnalytics() const {
+  std::stringstream text;
+  text << std::fixed << std::setprecision(2)
+       << "Polarization: " << frame_analytics_.polarization
+       << "  Flocks: " << frame_analytics_.num_flocks
+       << "  Largest flock: " << frame_analytics_.largest_flock
+       << "  Neighbors: " << frame_analytics_.mean_neighbors
+       << "  Step: " << frame_analytics_.step_ms << " ms"
+       << "  Quality level: " << frame_analytics_.quality_level
+       << "  Zoom: " << camera_.zoom();
+
+  if (boid_container_.state_writer() != nullptr) {
+    text << "  Exporting to " << kStateExportName;
+  }
+
+  const RenderBatch &render_batch = boid_container_.render_batch();
+  if (render_batch.detail != RenderDetail::kDensity) {
+    text << "  Drawn: " << render_batch.boids.size();
+  }
+
+  ci::gl::drawString(text.str(), glm::vec2(10, 10), ci::Color("White"));
+}
+
+void BoidSimApp::ResetCamera() {
+  camera_ = Camera2D(ci::app::getWindowSize(),
+                     glm::vec2(kWindowWidth / 2.0f, kWindowHeight / 2.0f));
+}
+
 } // namespace visualizer
 
 } // namespace boid_sim
\ No newline at end of file
@@ -0,0 +1,104 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <stdexcept>
+
+#include "visualizer/camera_2d.h"
+
+namespace boid_sim {
+
+namespace visualizer {
+
+namespace {
+
+// Boids with a body radius under this many pixels are drawn as points
+const float kPointPixels = 2.0f;
+
+// And under this many as a density texture
+const float kDensityPixels = 0.5f;
+
+} // namespace
+
+const float Camera2D::kMinZoom = 1.0f / 256.0f;
+const float Camera2D::kMaxZoom = 32.0f;
+
+Camera2D::Camera2D() : viewport_size_(1, 1), center_(0, 0), zoom_(1.0f) {}
+
+Camera2D::Camera2D(const glm::vec2 &viewport_size, const glm::vec2 &center,
+                   float zoom)
+    : center_(center) {
+  set_viewport_size(viewport_size);
+  set_zoom(zoom);
+}
+
+void Camera2D::Pan(const glm::vec2 &screen_offset) {
+  center_ -= screen_offset / zoom_;
+}
+
+void Camera2D::ZoomAt(const glm::vec2 &screen_point, float factor) {
+  if (!(factor > 0.0f)) {
+    throw std::invalid_argument("Zoom factor must be positive!");
+  }
+
+  glm::vec2 anchor = ScreenToWorld(screen_point);
+  zoom_ = std::min(kMaxZoom, std::max(kMinZoom, zoom_ * factor));
+
+  // Move the center so the anchor lands back under screen_point
+  center_ += anchor - ScreenToWorld(screen_point);
+}
+
+glm::vec2 Camera2D::ScreenToWorld(const glm::vec2 &screen_point) const {
+  return center_ + (screen_point - viewport_size_ * 0.5f) / zoom_;
+}
+
+glm::vec2 Camera2D::WorldToScreen(const glm::vec2 &world_point) const {
+  return (world_point - center_) * zoom_ + viewport_size_ * 0.5f;
+}
+
+void Camera2D::VisibleRect(glm::vec2 &min_corner,
+                           glm::vec2 &max_corner) const {
+  glm::vec2 half_extent = viewport_size_ * (0.5f / zoom_);
+  min_corner = center_ - half_extent;
+  max_corner = center_ + half_extent;
+}
+
+RenderDetail Camera2D::DetailFor(float body_radius) const {
+  float body_pixels = body_radius * zoom_;
+
+  if (body_pixels < kDensityPixels) {
+    return RenderDetail::kDensity;
+  } else if (body_pixels < kPointPixels) {
+    return RenderDetail::kPoints;
+  }
+
+  return RenderDetail::kTriangles;
+}
+
+const glm::vec2 &Camera2D::viewport_size() const { return viewport_size_; }
+
+void Camera2D::set_viewport_size(const glm::vec2 &viewport_size) {
+  if (!(viewport_size.x > 0.0f && viewport_size.y > 0.0f)) {
+    throw std::invalid_argument("Viewport must have a positive size!");
+  }
+
+  viewport_size_ = viewport_size;
+}
+
+const glm::vec2 &Camera2D::center() const { return center_; }
+
+void Camera2D::set_center(const glm::vec2 &center) { center_ = center; }
+
+float Camera2D::zoom() const { return zoom_; }
+
+void Camera2D::set_zoom(float zoom) {
+  if (!(zoom > 0.0f)) {
+    throw std::invalid_argument("Zoom must be positive!");
+  }
+
+  zoom_ = std::min(kMaxZoom, std::max(kMinZoom, zoom));
+}
+
+} // namespace visualizer
+
+} // namespace boid_sim
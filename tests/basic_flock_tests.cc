@@ -0,0 +1,136 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <catch2/catch.hpp>
+
+#include "core/basic_flock.h"
+#include "core/basic_spatial_grid.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("2D BasicFlock Matches BoidContainer") {
+  size_t num_frames = 40;
+  glm::vec2 mouse_pos(0, 0);
+  boid_sim::SpawnOptions options;
+  options.seed = 38;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+
+  boid_sim::visualizer::BoidContainer container(600, 400, 400, options);
+
+  std::vector<boid_sim::BasicBoid<2>> basic_boids;
+  for (const boid_sim::Boid &boid : container.boids()) {
+    boid_sim::BasicBoid<2> basic_boid(boid.id(), boid.position(),
+                                      boid.velocity(), boid.max_speed(),
+                                      boid.fov_radius());
+    basic_boid.set_velocity(boid.velocity());
+    basic_boids.push_back(basic_boid);
+  }
+
+  boid_sim::BasicFlock<2> flock(container.container_bounds(), basic_boids,
+                                container.flocking_params());
+  flock.set_num_threads(4);
+
+  for (size_t frame = 0; frame < num_frames; frame++) {
+    container.AdvanceOnFrame(mouse_pos);
+    flock.AdvanceOnFrame();
+  }
+
+  for (size_t i = 0; i < container.boids().size(); i++) {
+    REQUIRE(flock.boids()[i].position() == container.boids()[i].position());
+    REQUIRE(flock.boids()[i].velocity() == container.boids()[i].velocity());
+  }
+}
+
+TEST_CASE("3D BasicSpatialGrid Gather") {
+  std::vector<std::vector<float>> container_bounds{
+      {0, 100}, {0, 100}, {0, 100}};
+  std::vector<boid_sim::BasicBoid<3>> boids =
+      boid_sim::SpawnBasicSwarm<3>(container_bounds, 2000, 7);
+
+  std::vector<glm::vec3> positions;
+  for (const boid_sim::BasicBoid<3> &boid : boids) {
+    positions.push_back(boid.position());
+  }
+
+  boid_sim::BasicSpatialGrid<3> grid;
+  grid.Build(positions, container_bounds, 10.0f);
+
+  SECTION("Grid Dimensions") {
+    REQUIRE(grid.cells_along(0) == 10);
+    REQUIRE(grid.cells_along(2) == 10);
+    REQUIRE(grid.num_cells() == 1000);
+    REQUIRE(grid.entries().size() == positions.size());
+  }
+
+  SECTION("Gather Finds Every Position in Range") {
+    std::vector<size_t> candidates;
+
+    for (size_t i = 0; i < positions.size(); i += 97) {
+      grid.Gather(positions[i], 10.0f, candidates);
+
+      std::vector<size_t> found;
+      for (size_t candidate : candidates) {
+        if (glm::distance(positions[i], positions[candidate]) < 10.0f) {
+          found.push_back(candidate);
+        }
+      }
+
+      std::vector<size_t> expected;
+      for (size_t j = 0; j < positions.size(); j++) {
+        if (glm::distance(positions[i], positions[j]) < 10.0f) {
+          expected.push_back(j);
+        }
+      }
+
+      std::sort(found.begin(), found.end());
+      REQUIRE(found == expected);
+    }
+  }
+
+  SECTION("Unbounded Grid Covers the Swarm") {
+    boid_sim::BasicSpatialGrid<3> unbounded_grid;
+    unbounded_grid.Build(positions, {}, 10.0f);
+
+    REQUIRE(unbounded_grid.CellOf(glm::vec3(-500, -500, -500)) == 0);
+    REQUIRE(unbounded_grid.entries().size() == positions.size());
+  }
+}
+
+TEST_CASE("3D BasicFlock Stepping") {
+  std::vector<std::vector<float>> container_bounds{
+      {0, 400}, {0, 300}, {0, 200}};
+  std::vector<boid_sim::BasicBoid<3>> boids =
+      boid_sim::SpawnBasicSwarm<3>(container_bounds, 300, 2026);
+
+  boid_sim::BasicFlock<3> flock(container_bounds, boids);
+  boid_sim::BasicFlock<3> threaded_flock(container_bounds, boids);
+  threaded_flock.set_num_threads(8);
+
+  for (size_t frame = 0; frame < 200; frame++) {
+    flock.AdvanceOnFrame();
+    threaded_flock.AdvanceOnFrame();
+  }
+
+  SECTION("Same for Any Thread Count") {
+    for (size_t i = 0; i < boids.size(); i++) {
+      REQUIRE(flock.boids()[i].position() ==
+              threaded_flock.boids()[i].position());
+    }
+  }
+
+  SECTION("Boids Move and Stay Near the Container") {
+    for (size_t i = 0; i < boids.size(); i++) {
+      const glm::vec3 &position = flock.boids()[i].position();
+      REQUIRE(position != boids[i].position());
+      REQUIRE(glm::length(flock.boids()[i].velocity()) <=
+              flock.boids()[i].max_speed() + 0.001f);
+
+      for (int axis = 0; axis < 3; axis++) {
+        REQUIRE(position[axis] > container_bounds[axis][0] - 100.0f);
+        REQUIRE(position[axis] < container_bounds[axis][1] + 100.0f);
+      }
+    }
+
+    REQUIRE(flock.mean_candidates() > 0.0);
+  }
+}
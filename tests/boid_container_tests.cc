@@ -1,9 +1,11 @@
 //
 // Created by Kaelan Davis on 4/20/2021.
 //
+#include <algorithm>
 #include <catch2/catch.hpp>
 
 #include "core/boid.h"
+#include "core/boid_record.h"
 #include "visualizer/boid_container.h"
 
 TEST_CASE("SeekMouse Test") {
@@ -41,4 +43,234 @@ TEST_CASE("DefaultBehavior Test") {
   for (const boid_sim::Boid &boid : container.boids()) {
     REQUIRE_FALSE(boid.is_seek_mouse());
   }
-}
\ No newline at end of file
+}
+
+namespace {
+
+std::vector<size_t> BruteForceRadius(const std::vector<boid_sim::Boid> &boids,
+                                     const glm::vec2 &center, float radius) {
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < boids.size(); i++) {
+    if (glm::distance(boids[i].position(), center) <= radius) {
+      indices.push_back(i);
+    }
+  }
+
+  return indices;
+}
+
+size_t BruteForceNearest(const std::vector<boid_sim::Boid> &boids,
+                         const glm::vec2 &point) {
+  size_t nearest = 0;
+  for (size_t i = 1; i < boids.size(); i++) {
+    if (glm::distance(boids[i].position(), point) <
+        glm::distance(boids[nearest].position(), point)) {
+      nearest = i;
+    }
+  }
+
+  return nearest;
+}
+
+void CheckQueries(const boid_sim::visualizer::BoidContainer &container) {
+  const std::vector<boid_sim::Boid> &boids = container.boids();
+  // Several points share a cell so the batched queries share candidates
+  std::vector<glm::vec2> points{{10, 10},   {200, 150}, {390, 290},
+                                {-50, 400}, {120, 60},  {1000, -1000},
+                                {205, 148}, {196, 160}, {12, 30}};
+  std::vector<size_t> indices;
+  std::vector<size_t> scratch;
+  std::vector<size_t> nearest;
+  boid_sim::visualizer::BoidContainer::QueryScratch batch_scratch;
+
+  for (const glm::vec2 &point : points) {
+    container.QueryRadius(point, 40.0f, indices);
+    REQUIRE(indices == BruteForceRadius(boids, point, 40.0f));
+
+    REQUIRE(container.QueryNearest(point, scratch) ==
+            BruteForceNearest(boids, point));
+  }
+
+  container.QueryNearest(points, nearest, batch_scratch);
+  for (size_t query = 0; query < points.size(); query++) {
+    REQUIRE(nearest[query] == BruteForceNearest(boids, points[query]));
+  }
+
+  // Queries all around every boid crowd cells enough for them to share
+  std::vector<glm::vec2> offsets{{3, -2}, {-5, 4}, {0.5f, 7}, {-2, -6}};
+  std::vector<glm::vec2> crowded;
+  for (const boid_sim::Boid &boid : boids) {
+    for (const glm::vec2 &offset : offsets) {
+      crowded.push_back(boid.position() + offset);
+    }
+  }
+
+  container.QueryNearest(crowded, nearest, batch_scratch);
+  for (size_t query = 0; query < crowded.size(); query++) {
+    REQUIRE(nearest[query] == BruteForceNearest(boids, crowded[query]));
+  }
+
+  container.QueryRect(glm::vec2(50, 40), glm::vec2(300, 120), indices);
+  std::vector<size_t> expected;
+  for (size_t i = 0; i < boids.size(); i++) {
+    const glm::vec2 &position = boids[i].position();
+    if (position.x >= 50 && position.x <= 300 && position.y >= 40 &&
+        position.y <= 120) {
+      expected.push_back(i);
+    }
+  }
+  REQUIRE(indices == expected);
+}
+
+} // namespace
+
+TEST_CASE("Spatial Queries") {
+  boid_sim::SpawnOptions options;
+  options.seed = 31;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+  boid_sim::visualizer::BoidContainer container(400, 300, 400, options);
+  glm::vec2 mouse_pos(0, 0);
+
+  SECTION("Before the First Frame") { CheckQueries(container); }
+
+  SECTION("Between Frames") {
+    for (size_t frame = 0; frame < 20; frame++) {
+      container.AdvanceOnFrame(mouse_pos);
+    }
+
+    CheckQueries(container);
+  }
+
+  SECTION("Unbounded World") {
+    container.set_unbounded(true);
+    for (size_t frame = 0; frame < 20; frame++) {
+      container.AdvanceOnFrame(mouse_pos);
+    }
+
+    REQUIRE(container.uses_sparse_grid());
+    CheckQueries(container);
+  }
+
+  SECTION("After Replacing the Boids") {
+    container.AdvanceOnFrame(mouse_pos);
+    std::vector<boid_sim::Boid> boids = container.boids();
+    std::reverse(boids.begin(), boids.end());
+    container.set_boids(boids);
+
+    CheckQueries(container);
+  }
+
+  SECTION("Empty Container") {
+    boid_sim::visualizer::BoidContainer empty(400, 300, 0, options);
+    std::vector<size_t> scratch;
+
+    REQUIRE(empty.QueryNearest(glm::vec2(5, 5), scratch) == 0);
+  }
+}
+
+TEST_CASE("Predators and Prey") {
+  glm::vec2 mouse_pos(0, 0);
+  boid_sim::SpawnOptions options;
+  options.seed = 39;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+
+  boid_sim::visualizer::BoidContainer container(600, 400, 300, options);
+  container.AddPredators(6);
+
+  SECTION("Predators Follow the Prey") {
+    const std::vector<boid_sim::Boid> &boids = container.boids();
+
+    REQUIRE(boids.size() == 306);
+    REQUIRE(container.num_predators() == 6);
+    REQUIRE(boids[299].role() == boid_sim::BoidRole::kPrey);
+    REQUIRE(boids[300].role() == boid_sim::BoidRole::kPredator);
+    REQUIRE(boids[305].id() == 305);
+    REQUIRE(boids[305].max_speed() ==
+            container.flocking_params().predator_max_speed);
+  }
+
+  SECTION("Matches Checking Every Boid") {
+    std::vector<boid_sim::Boid> expected = container.boids();
+    boid_sim::FlockingParams params = container.flocking_params();
+    std::vector<std::vector<float>> bounds = container.container_bounds();
+
+    for (size_t frame = 0; frame < 25; frame++) {
+      std::vector<boid_sim::Boid> snapshot = expected;
+
+      for (boid_sim::Boid &boid : expected) {
+        bool is_predator = boid.role() == boid_sim::BoidRole::kPredator;
+        float radius = is_predator ? params.hunt_radius : params.flee_radius;
+        std::vector<boid_sim::Boid> neighbors;
+        size_t nearest = snapshot.size();
+        float nearest_distance = radius;
+
+        for (size_t j = 0; j < snapshot.size(); j++) {
+          float distance =
+              glm::distance(boid.position(), snapshot[j].position());
+
+          if (snapshot[j].role() == boid.role()) {
+            if (distance < boid.fov_radius()) {
+              neighbors.push_back(snapshot[j]);
+            }
+          } else if (distance < nearest_distance) {
+            nearest = j;
+            nearest_distance = distance;
+          }
+        }
+
+        glm::vec2 external_force(0, 0);
+        if (nearest != snapshot.size()) {
+          external_force = is_predator
+                               ? boid.Pursue(snapshot[nearest].position())
+                               : boid.Flee(snapshot[nearest].position());
+        }
+
+        boid.UpdatePosition(bounds, neighbors, mouse_pos, params.align_percent,
+                            params.cohesion_percent, params.separation_percent,
+                            external_force);
+      }
+    }
+
+    uint64_t expected_hash = boid_sim::HashSwarm(expected);
+
+    for (size_t num_threads : {1, 4}) {
+      boid_sim::visualizer::BoidContainer threaded = container;
+      threaded.set_num_threads(num_threads);
+
+      for (size_t frame = 0; frame < 25; frame++) {
+        threaded.AdvanceOnFrame(mouse_pos);
+      }
+
+      REQUIRE(boid_sim::HashSwarm(threaded.boids()) == expected_hash);
+    }
+  }
+
+  SECTION("Prey Flee and Predators Chase") {
+    glm::vec2 prey_position(300, 200);
+    glm::vec2 predator_position(330, 200);
+    glm::vec2 direction(0, 1);
+
+    boid_sim::Boid prey(0, prey_position, direction);
+    boid_sim::Boid predator(1, predator_position, direction, 2.5f);
+    predator.set_role(boid_sim::BoidRole::kPredator);
+    container.set_boids({predator, prey});
+
+    REQUIRE(container.boids()[0].role() == boid_sim::BoidRole::kPrey);
+    REQUIRE(container.num_predators() == 1);
+
+    container.AdvanceOnFrame(mouse_pos);
+
+    REQUIRE(container.boids()[0].velocity().x < 0.0f);
+    REQUIRE(container.boids()[1].velocity().x < 0.0f);
+  }
+
+  SECTION("Queries Cover Both Roles") {
+    container.AdvanceOnFrame(mouse_pos);
+
+    std::vector<size_t> indices;
+    container.QueryRect(glm::vec2(-1000, -1000), glm::vec2(2000, 2000),
+                        indices);
+
+    REQUIRE(indices.size() == container.boids().size());
+  }
+}
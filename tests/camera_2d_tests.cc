@@ -0,0 +1,159 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+#include <numeric>
+
+#include "visualizer/boid_container.h"
+#include "visualizer/camera_2d.h"
+
+using boid_sim::visualizer::Camera2D;
+using boid_sim::visualizer::RenderBatch;
+using boid_sim::visualizer::RenderDetail;
+
+namespace {
+
+bool Near(const glm::vec2 &point1, const glm::vec2 &point2) {
+  return glm::distance(point1, point2) < 1e-3f;
+}
+
+} // namespace
+
+TEST_CASE("Camera2D Tests") {
+  Camera2D camera(glm::vec2(800, 600), glm::vec2(400, 300));
+
+  SECTION("Unzoomed Camera Maps Screen onto World") {
+    REQUIRE(Near(camera.ScreenToWorld(glm::vec2(0, 0)), glm::vec2(0, 0)));
+    REQUIRE(Near(camera.WorldToScreen(glm::vec2(800, 600)),
+                 glm::vec2(800, 600)));
+
+    glm::vec2 min_corner;
+    glm::vec2 max_corner;
+    camera.VisibleRect(min_corner, max_corner);
+
+    REQUIRE(Near(min_corner, glm::vec2(0, 0)));
+    REQUIRE(Near(max_corner, glm::vec2(800, 600)));
+  }
+
+  SECTION("Pan Drags the World Along") {
+    camera.Pan(glm::vec2(100, -50));
+
+    REQUIRE(Near(camera.WorldToScreen(glm::vec2(0, 0)), glm::vec2(100, -50)));
+  }
+
+  SECTION("Zoom Keeps the Point Under the Cursor") {
+    glm::vec2 cursor(200, 450);
+    glm::vec2 anchor = camera.ScreenToWorld(cursor);
+    camera.ZoomAt(cursor, 4.0f);
+
+    REQUIRE(camera.zoom() == 4.0f);
+    REQUIRE(Near(camera.WorldToScreen(anchor), cursor));
+
+    glm::vec2 min_corner;
+    glm::vec2 max_corner;
+    camera.VisibleRect(min_corner, max_corner);
+
+    REQUIRE(Near(max_corner - min_corner, glm::vec2(200, 150)));
+  }
+
+  SECTION("Zoom Is Clamped") {
+    camera.ZoomAt(glm::vec2(0, 0), 1e9f);
+    REQUIRE(camera.zoom() == Camera2D::kMaxZoom);
+
+    camera.set_zoom(1e-9f);
+    REQUIRE(camera.zoom() == Camera2D::kMinZoom);
+  }
+
+  SECTION("Detail Drops as Boids Shrink on Screen") {
+    REQUIRE(camera.DetailFor(6.0f) == RenderDetail::kTriangles);
+
+    camera.set_zoom(0.25f);
+    REQUIRE(camera.DetailFor(6.0f) == RenderDetail::kPoints);
+
+    camera.set_zoom(0.05f);
+    REQUIRE(camera.DetailFor(6.0f) == RenderDetail::kDensity);
+  }
+
+  SECTION("Invalid Arguments") {
+    REQUIRE_THROWS_AS(camera.ZoomAt(glm::vec2(0, 0), 0.0f),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(camera.set_zoom(-1.0f), std::invalid_argument);
+    REQUIRE_THROWS_AS(camera.set_viewport_size(glm::vec2(0, 600)),
+                      std::invalid_argument);
+  }
+}
+
+TEST_CASE("Culling for a Camera") {
+  boid_sim::SpawnOptions options;
+  options.seed = 42;
+  boid_sim::visualizer::BoidContainer container(4000, 4000, 5000, options);
+  container.AddPredators(5);
+  glm::vec2 mouse_pos(0, 0);
+  container.AdvanceOnFrame(mouse_pos);
+
+  const std::vector<boid_sim::Boid> &boids = container.boids();
+  RenderBatch batch;
+
+  SECTION("Zoomed In Only the Boids in View Are Drawn") {
+    Camera2D camera(glm::vec2(800, 600), glm::vec2(1200, 2500), 2.0f);
+    container.CullForCamera(camera, batch);
+
+    REQUIRE(batch.detail == RenderDetail::kTriangles);
+    REQUIRE(std::is_sorted(batch.boids.begin(), batch.boids.end()));
+
+    glm::vec2 min_corner;
+    glm::vec2 max_corner;
+    camera.VisibleRect(min_corner, max_corner);
+
+    size_t num_visible = 0;
+    for (size_t i = 0; i < boids.size(); i++) {
+      const glm::vec2 &position = boids[i].position();
+
+      if (position.x >= min_corner.x && position.x <= max_corner.x &&
+          position.y >= min_corner.y && position.y <= max_corner.y) {
+        REQUIRE(std::binary_search(batch.boids.begin(), batch.boids.end(),
+                                   i));
+        num_visible++;
+      }
+    }
+
+    // The view covers under 1% of the world, plus a body's width around it
+    REQUIRE(batch.boids.size() >= num_visible);
+    REQUIRE(batch.boids.size() < boids.size() / 20);
+  }
+
+  SECTION("Zoomed Out Boids Become Points") {
+    Camera2D camera(glm::vec2(800, 600), glm::vec2(2000, 2000), 0.2f);
+    container.CullForCamera(camera, batch);
+
+    REQUIRE(batch.detail == RenderDetail::kPoints);
+    REQUIRE(batch.boids.size() > boids.size() / 10);
+  }
+
+  SECTION("Far Out Boids Become a Density Texture") {
+    // The whole world fits on screen
+    Camera2D camera(glm::vec2(800, 600), glm::vec2(2000, 2000), 0.05f);
+    container.CullForCamera(camera, batch);
+
+    REQUIRE(batch.detail == RenderDetail::kDensity);
+    REQUIRE(batch.boids.empty());
+    REQUIRE(batch.density.size() ==
+            batch.density_columns * batch.density_rows);
+    REQUIRE(batch.density_cell_size * camera.zoom() >= 4.0f);
+    REQUIRE(std::accumulate(batch.density.begin(), batch.density.end(),
+                            (size_t)0) == boids.size());
+  }
+
+  SECTION("Density of a Sparse Index Bins the Boids in View") {
+    container.set_unbounded(true);
+    container.AdvanceOnFrame(mouse_pos);
+    REQUIRE(container.uses_sparse_grid());
+
+    Camera2D camera(glm::vec2(800, 600), glm::vec2(2000, 2000), 0.02f);
+    container.CullForCamera(camera, batch);
+
+    REQUIRE(batch.detail == RenderDetail::kDensity);
+    REQUIRE(std::accumulate(batch.density.begin(), batch.density.end(),
+                            (size_t)0) == boids.size());
+  }
+}
@@ -0,0 +1,137 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <fstream>
+
+#include "core/boid.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("Checkpoint Save and Restore") {
+  std::string path = "checkpoint_tests.bin";
+  size_t display_window_width = 500;
+  size_t display_window_height = 300;
+  size_t num_boids = 60;
+  glm::vec2 mouse_pos(0, 0);
+
+  boid_sim::visualizer::BoidContainer container(
+      display_window_width, display_window_height, num_boids - 3);
+  container.AddPredators(3);
+  container.SeekMouse();
+  container.set_unbounded(true);
+
+  boid_sim::FlockingParams flocking_params;
+  flocking_params.max_speed = 3.0f;
+  flocking_params.fov_radius = 60.0f;
+  flocking_params.view_angle = 270.0f;
+  flocking_params.predator_max_speed = 3.5f;
+  flocking_params.hunt_radius = 120.0f;
+  container.set_flocking_params(flocking_params);
+
+  // Low thresholds so level of detail and the far field change the run
+  boid_sim::FidelitySettings fidelity;
+  fidelity.max_neighbors = 12;
+  fidelity.substeps = 2;
+  fidelity.lod_neighbor_threshold = 8;
+  fidelity.far_field_neighbor_threshold = 4;
+  container.set_fidelity(fidelity);
+
+  for (size_t frame = 0; frame < 10; frame++) {
+    container.AdvanceOnFrame(mouse_pos);
+  }
+
+  container.SaveCheckpoint(path);
+
+  SECTION("Restores Identical State") {
+    boid_sim::visualizer::BoidContainer restored(10, 10, 1);
+    restored.RestoreCheckpoint(path);
+
+    REQUIRE(restored.container_bounds() == container.container_bounds());
+    REQUIRE(restored.rng().seed() == container.rng().seed());
+    REQUIRE(restored.rng().counter() == container.rng().counter());
+    REQUIRE(restored.is_unbounded());
+    REQUIRE(restored.fidelity() == fidelity);
+    REQUIRE(restored.frame_count() == container.frame_count());
+    REQUIRE(restored.neighbor_counts() == container.neighbor_counts());
+    REQUIRE(restored.flocking_params().max_speed == flocking_params.max_speed);
+    REQUIRE(restored.flocking_params().fov_radius ==
+            flocking_params.fov_radius);
+    REQUIRE(restored.flocking_params().view_angle ==
+            flocking_params.view_angle);
+    REQUIRE(restored.flocking_params().predator_max_speed ==
+            flocking_params.predator_max_speed);
+    REQUIRE(restored.flocking_params().hunt_radius ==
+            flocking_params.hunt_radius);
+    REQUIRE(restored.boids().size() == num_boids);
+
+    for (size_t i = 0; i < num_boids; i++) {
+      REQUIRE_FALSE(restored.boids()[i] != container.boids()[i]);
+      REQUIRE(restored.boids()[i].is_seek_mouse());
+      REQUIRE(restored.boids()[i].fov_radius() ==
+              container.boids()[i].fov_radius());
+      REQUIRE(restored.boids()[i].role() == container.boids()[i].role());
+    }
+  }
+
+  SECTION("Restored Run Continues Deterministically") {
+    boid_sim::visualizer::BoidContainer restored;
+    restored.RestoreCheckpoint(path);
+
+    // Boids spawned after the restore take the saved speeds and vision
+    container.AddPredators(2);
+    restored.AddPredators(2);
+
+    for (size_t frame = 0; frame < 20; frame++) {
+      container.AdvanceOnFrame(mouse_pos);
+      restored.AdvanceOnFrame(mouse_pos);
+
+      REQUIRE(restored.boids().size() == container.boids().size());
+      for (size_t i = 0; i < container.boids().size(); i++) {
+        REQUIRE_FALSE(restored.boids()[i] != container.boids()[i]);
+      }
+    }
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST_CASE("Checkpoint Restore Errors") {
+  boid_sim::visualizer::BoidContainer container(10, 10, 1);
+
+  SECTION("Missing File") {
+    REQUIRE_THROWS_AS(container.RestoreCheckpoint("missing_checkpoint.bin"),
+                      std::runtime_error);
+  }
+
+  SECTION("Not a Checkpoint") {
+    std::string path = "not_a_checkpoint.bin";
+    std::ofstream file(path, std::ios::binary);
+    file << "definitely not a checkpoint, but long enough to have a header";
+    file.close();
+
+    REQUIRE_THROWS_AS(container.RestoreCheckpoint(path),
+                      std::invalid_argument);
+
+    std::remove(path.c_str());
+  }
+
+  SECTION("Truncated File") {
+    std::string path = "truncated_checkpoint.bin";
+    container.SaveCheckpoint(path);
+
+    std::ifstream in(path, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+    in.close();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), contents.size() - 4);
+    out.close();
+
+    REQUIRE_THROWS_AS(container.RestoreCheckpoint(path),
+                      std::invalid_argument);
+
+    std::remove(path.c_str());
+  }
+}
@@ -0,0 +1,165 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cmath>
+
+#include "core/basic_flock.h"
+#include "core/compact_flock.h"
+
+namespace {
+
+/*
+ * Largest difference along any axis between the positions, and between the
+ * velocities, of two swarms in id order
+ */
+template <int Dim>
+void MaxErrors(const std::vector<boid_sim::BasicBoid<Dim>> &boids1,
+               const std::vector<boid_sim::BasicBoid<Dim>> &boids2,
+               float &position_error, float &velocity_error) {
+  position_error = 0.0f;
+  velocity_error = 0.0f;
+
+  for (size_t i = 0; i < boids1.size(); i++) {
+    for (int axis = 0; axis < Dim; axis++) {
+      position_error =
+          std::max(position_error, std::abs(boids1[i].position()[axis] -
+                                            boids2[i].position()[axis]));
+      velocity_error =
+          std::max(velocity_error, std::abs(boids1[i].velocity()[axis] -
+                                            boids2[i].velocity()[axis]));
+    }
+  }
+}
+
+} // namespace
+
+TEST_CASE("CompactFlock Quantization") {
+  std::vector<std::vector<float>> container_bounds{{0, 1000}, {0, 800}};
+  std::vector<boid_sim::BasicBoid<2>> boids =
+      boid_sim::SpawnBasicSwarm<2>(container_bounds, 2000, 43);
+  boid_sim::CompactFlock<2> flock(container_bounds, boids);
+
+  SECTION("Stores Less Than Float State") {
+    REQUIRE(boid_sim::CompactFlock<2>::bytes_per_boid() == 12);
+    REQUIRE(boid_sim::CompactFlock<3>::bytes_per_boid() == 16);
+    REQUIRE(boid_sim::CompactFlock<2>::bytes_per_boid() <
+            sizeof(boid_sim::BasicBoid<2>));
+  }
+
+  SECTION("Decoded State Is Within the Error Bounds") {
+    std::vector<boid_sim::BasicBoid<2>> decoded = flock.boids();
+    REQUIRE(decoded.size() == boids.size());
+
+    float position_error = 0.0f;
+    float velocity_error = 0.0f;
+    MaxErrors(boids, decoded, position_error, velocity_error);
+
+    REQUIRE(position_error <= flock.position_error_bound());
+    REQUIRE(velocity_error <= flock.velocity_error_bound());
+    REQUIRE(flock.position_error_bound() < 0.01f);
+    REQUIRE(flock.velocity_error_bound() < 1e-4f);
+
+    for (size_t i = 0; i < boids.size(); i++) {
+      REQUIRE(decoded[i].id() == boids[i].id());
+    }
+  }
+
+  SECTION("Mean Position Matches the Decoded Boids") {
+    glm::vec2 sum(0, 0);
+    for (const boid_sim::BasicBoid<2> &boid : flock.boids()) {
+      sum += boid.position();
+    }
+
+    REQUIRE(glm::distance(flock.mean_position(), sum / 2000.0f) < 0.01f);
+  }
+
+  SECTION("One Frame Stays Within the Bounds of Float Stepping") {
+    // Start the float swarm from exactly the quantized state, so the only
+    // differences are storing the result and the order neighbors are summed
+    boid_sim::BasicFlock<2> float_flock(container_bounds, flock.boids());
+    float_flock.AdvanceOnFrame();
+    flock.AdvanceOnFrame();
+
+    float position_error = 0.0f;
+    float velocity_error = 0.0f;
+    MaxErrors(float_flock.boids(), flock.boids(), position_error,
+              velocity_error);
+
+    // Summing neighbors in another order moves the velocity before it is
+    // stored by less than one velocity step of max_speed / 32767, so the
+    // velocity is allowed that one step past the quantization bound
+    float velocity_step = boids[0].max_speed() / 32767.0f;
+    REQUIRE(position_error <= flock.position_error_bound());
+    REQUIRE(velocity_error <= flock.velocity_error_bound() + velocity_step);
+  }
+
+  SECTION("Same for Any Thread Count") {
+    boid_sim::CompactFlock<2> threaded_flock(container_bounds, boids);
+    threaded_flock.set_num_threads(8);
+
+    for (size_t frame = 0; frame < 30; frame++) {
+      flock.AdvanceOnFrame();
+      threaded_flock.AdvanceOnFrame();
+    }
+
+    std::vector<boid_sim::BasicBoid<2>> decoded = flock.boids();
+    std::vector<boid_sim::BasicBoid<2>> threaded = threaded_flock.boids();
+
+    for (size_t i = 0; i < decoded.size(); i++) {
+      REQUIRE(decoded[i].position() == threaded[i].position());
+      REQUIRE(decoded[i].velocity() == threaded[i].velocity());
+    }
+  }
+}
+
+TEST_CASE("3D CompactFlock Stepping") {
+  std::vector<std::vector<float>> container_bounds{
+      {0, 400}, {0, 300}, {0, 200}};
+  std::vector<boid_sim::BasicBoid<3>> boids =
+      boid_sim::SpawnBasicSwarm<3>(container_bounds, 300, 2026);
+  boid_sim::CompactFlock<3> flock(container_bounds, boids);
+
+  for (size_t frame = 0; frame < 200; frame++) {
+    flock.AdvanceOnFrame();
+  }
+
+  std::vector<boid_sim::BasicBoid<3>> decoded = flock.boids();
+  REQUIRE(decoded.size() == boids.size());
+
+  for (size_t i = 0; i < decoded.size(); i++) {
+    const glm::vec3 &position = decoded[i].position();
+    REQUIRE(position != boids[i].position());
+    REQUIRE(glm::length(decoded[i].velocity()) <=
+            decoded[i].max_speed() + 0.001f);
+
+    for (int axis = 0; axis < 3; axis++) {
+      REQUIRE(position[axis] > container_bounds[axis][0] - 100.0f);
+      REQUIRE(position[axis] < container_bounds[axis][1] + 100.0f);
+    }
+  }
+}
+
+TEST_CASE("CompactFlock Errors") {
+  boid_sim::FlockingParams params;
+  std::vector<std::vector<float>> container_bounds{{0, 100}, {0, 100}};
+
+  SECTION("Unbounded World") {
+    REQUIRE_THROWS_AS(boid_sim::CompactFlock<2>(
+                          {}, boid_sim::SpawnBasicSwarm<2>(container_bounds,
+                                                           10, 1)),
+                      std::invalid_argument);
+  }
+
+  SECTION("Boids With Different Speeds") {
+    std::vector<boid_sim::BasicBoid<2>> boids =
+        boid_sim::SpawnBasicSwarm<2>(container_bounds, 10, 1);
+    boids.push_back(boid_sim::BasicBoid<2>(10, glm::vec2(5, 5),
+                                           glm::vec2(1, 0),
+                                           params.max_speed * 2.0f));
+
+    REQUIRE_THROWS_AS(boid_sim::CompactFlock<2>(container_bounds, boids),
+                      std::invalid_argument);
+  }
+}
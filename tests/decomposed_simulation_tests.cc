@@ -0,0 +1,217 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "core/boid.h"
+#include "core/decomposed_simulation.h"
+#include "core/halo_transport.h"
+#include "core/tile_layout.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("TileLayout Tests") {
+  std::vector<std::vector<float>> container_bounds{{0, 100}, {0, 50}};
+  boid_sim::TileLayout layout(container_bounds, 4, 2);
+
+  SECTION("Tile Ownership") {
+    REQUIRE(layout.num_tiles() == 8);
+    REQUIRE(layout.TileOf(glm::vec2(10, 10)) == 0);
+    REQUIRE(layout.TileOf(glm::vec2(60, 40)) == 6);
+  }
+
+  SECTION("Out of Bounds Positions Belong to Outer Tiles") {
+    REQUIRE(layout.TileOf(glm::vec2(-20, -20)) == 0);
+    REQUIRE(layout.TileOf(glm::vec2(120, 70)) == 7);
+    REQUIRE(layout.DistanceToTile(glm::vec2(-20, -20), 0) == 0.0f);
+  }
+
+  SECTION("Distance to Tile") {
+    REQUIRE(layout.DistanceToTile(glm::vec2(10, 10), 1) ==
+            Approx(15.0f));
+    REQUIRE(layout.DistanceToTile(glm::vec2(22, 22), 5) ==
+            Approx(std::sqrt(3.0f * 3.0f + 3.0f * 3.0f)));
+  }
+
+  SECTION("Tiles Within Radius") {
+    std::vector<size_t> tiles;
+    layout.TilesWithin(glm::vec2(24, 24), 2.0f, tiles);
+
+    REQUIRE(tiles.size() == 3);
+
+    layout.TilesWithin(glm::vec2(10, 10), 2.0f, tiles);
+
+    REQUIRE(tiles.empty());
+  }
+
+  SECTION("Zero Tiles") {
+    REQUIRE_THROWS_AS(boid_sim::TileLayout(container_bounds, 0, 2),
+                      std::invalid_argument);
+  }
+}
+
+TEST_CASE("Decomposed Simulation Matches Single Process") {
+  size_t display_window_width = 600;
+  size_t display_window_height = 400;
+  size_t num_boids = 120;
+  size_t num_frames = 40;
+  boid_sim::visualizer::BoidContainer container(
+      display_window_width, display_window_height, num_boids);
+  glm::vec2 mouse_pos(0, 0);
+
+  boid_sim::InProcessQueueTransport in_process_transport;
+  boid_sim::LoopbackTransport loopback_transport;
+
+  SECTION("In Process Queue Transport") {
+    boid_sim::DecomposedSimulation simulation(container.container_bounds(),
+                                              container.boids(), 3, 2,
+                                              in_process_transport);
+
+    for (size_t frame = 0; frame < num_frames; frame++) {
+      container.AdvanceOnFrame(mouse_pos);
+      simulation.AdvanceOnFrame(mouse_pos);
+    }
+
+    std::vector<boid_sim::Boid> expected = container.boids();
+    std::vector<boid_sim::Boid> actual = simulation.boids();
+
+    REQUIRE(expected.size() == actual.size());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+      REQUIRE_FALSE(expected[i] != actual[i]);
+    }
+  }
+
+  SECTION("Loopback Transport") {
+    boid_sim::DecomposedSimulation simulation(container.container_bounds(),
+                                              container.boids(), 2, 2,
+                                              loopback_transport);
+
+    for (size_t frame = 0; frame < num_frames; frame++) {
+      container.AdvanceOnFrame(mouse_pos);
+      simulation.AdvanceOnFrame(mouse_pos);
+    }
+
+    std::vector<boid_sim::Boid> expected = container.boids();
+    std::vector<boid_sim::Boid> actual = simulation.boids();
+
+    REQUIRE(loopback_transport.bytes_sent() > 0);
+    REQUIRE(expected.size() == actual.size());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+      REQUIRE_FALSE(expected[i] != actual[i]);
+    }
+  }
+}
+
+#ifndef _WIN32
+TEST_CASE("Decomposed Simulation Matches Single Process With Worker "
+          "Processes") {
+  boid_sim::visualizer::BoidContainer container(600, 400, 120);
+  glm::vec2 mouse_pos(0, 0);
+
+  boid_sim::SharedMemoryTransport transport;
+  boid_sim::DecomposedSimulation simulation(
+      container.container_bounds(), container.boids(), 3, 2, transport);
+
+  REQUIRE(simulation.uses_worker_processes());
+
+  // Reading the boids back between frames must not disturb the workers
+  for (size_t frame = 0; frame < 40; frame++) {
+    container.AdvanceOnFrame(mouse_pos);
+    simulation.AdvanceOnFrame(mouse_pos);
+
+    if (frame % 10 != 9) {
+      continue;
+    }
+
+    std::vector<boid_sim::Boid> expected = container.boids();
+    std::vector<boid_sim::Boid> actual = simulation.boids();
+
+    REQUIRE(expected.size() == actual.size());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+      REQUIRE_FALSE(expected[i] != actual[i]);
+    }
+  }
+}
+
+TEST_CASE("Shared Memory Transport Tests") {
+  glm::vec2 position1(10, 20);
+  glm::vec2 position2(30, 40);
+  glm::vec2 direction(1, 0);
+  std::vector<boid_sim::Boid> boids{
+      boid_sim::Boid(0, position1, direction, 2.0f, 10.0f),
+      boid_sim::Boid(1, position2, direction, 2.0f, 10.0f)};
+
+  boid_sim::SharedMemoryTransport transport;
+  transport.Open(2, 3);
+
+  SECTION("Delivers Boids Sent From Another Process") {
+    pid_t pid = fork();
+    if (pid == 0) {
+      transport.Send(1, boids);
+      _exit(0);
+    }
+
+    int status = -1;
+    waitpid(pid, &status, 0);
+
+    std::vector<boid_sim::Boid> received;
+    transport.Receive(0, received);
+
+    REQUIRE(received.empty());
+
+    transport.Receive(1, received);
+
+    REQUIRE(status == 0);
+    REQUIRE(received.size() == 2);
+    REQUIRE_FALSE(received[0] != boids[0]);
+    REQUIRE_FALSE(received[1] != boids[1]);
+  }
+
+  SECTION("Receiving Empties the Mailbox") {
+    std::vector<boid_sim::Boid> received;
+    transport.Send(0, boids);
+    transport.Receive(0, received);
+    transport.Receive(0, received);
+
+    REQUIRE(received.size() == 2);
+  }
+
+  SECTION("Full Mailbox") {
+    transport.Send(0, boids);
+
+    REQUIRE_THROWS_AS(transport.Send(0, boids), std::runtime_error);
+  }
+
+  SECTION("Unknown Tile") {
+    REQUIRE_THROWS_AS(transport.Send(2, boids), std::out_of_range);
+  }
+}
+#endif
+
+TEST_CASE("Decomposed Simulation Migration") {
+  std::vector<std::vector<float>> container_bounds{{0, 100}, {0, 100}};
+  glm::vec2 mouse_pos(0, 0);
+  glm::vec2 position(49, 25);
+  glm::vec2 direction(1, 0);
+  boid_sim::Boid boid(0, position, direction, 2.0f, 10.0f);
+  std::vector<boid_sim::Boid> boids{boid};
+
+  boid_sim::InProcessQueueTransport transport;
+  boid_sim::DecomposedSimulation simulation(container_bounds, boids, 2, 1,
+                                            transport);
+
+  REQUIRE(simulation.tile_boids(0).size() == 1);
+
+  simulation.AdvanceOnFrame(mouse_pos);
+
+  REQUIRE(simulation.tile_boids(0).empty());
+  REQUIRE(simulation.tile_boids(1).size() == 1);
+  REQUIRE(simulation.boids().size() == 1);
+}
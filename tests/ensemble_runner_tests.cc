@@ -0,0 +1,120 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+#include <sstream>
+
+#include "headless/ensemble_runner.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("EnsembleRunner Tests") {
+  boid_sim::headless::EnsembleGrid grid;
+  grid.align_percents = {0.0f, .3f};
+  grid.cohesion_percents = {.5f, .95f, 1.5f};
+  grid.boid_counts = {20, 40};
+
+  boid_sim::headless::EnsembleSettings settings;
+  settings.container_width = 300;
+  settings.container_height = 200;
+  settings.num_frames = 15;
+  settings.num_replicas = 2;
+  settings.spawn_options.seed = 5;
+
+  SECTION("Every Combination Becomes a Run") {
+    boid_sim::headless::EnsembleRunner runner(grid, settings);
+
+    REQUIRE(runner.runs().size() == 2 * 3 * 2 * 2);
+    REQUIRE(runner.runs()[0].seed == 5);
+    REQUIRE(runner.runs().back().seed == 6);
+    REQUIRE(runner.runs().back().flocking_params.cohesion_percent == 1.5f);
+  }
+
+  SECTION("Runs That Only Differ in Weights Share a Starting Swarm") {
+    boid_sim::headless::EnsembleRunner runner(grid, settings);
+    const std::vector<boid_sim::headless::EnsembleRun> &runs = runner.runs();
+
+    // 2 align x 3 cohesion weights per swarm, 2 boid counts x 2 replicas
+    REQUIRE(runs[0].swarm == 0);
+    REQUIRE(runs[5].swarm == 0);
+    REQUIRE(runs[6].swarm == 1);
+    REQUIRE(runs.back().swarm == 3);
+  }
+
+  SECTION("Matches a Run Spawned on Its Own") {
+    settings.num_threads = 2;
+    boid_sim::headless::EnsembleRunner runner(grid, settings);
+    std::vector<boid_sim::headless::RunSummary> summaries = runner.Run();
+
+    const boid_sim::headless::EnsembleRun &run = runner.runs()[4];
+    boid_sim::SpawnOptions spawn_options = settings.spawn_options;
+    spawn_options.seed = run.seed;
+    boid_sim::visualizer::BoidContainer container(
+        settings.container_width, settings.container_height, run.num_boids,
+        spawn_options, run.flocking_params);
+    container.EnableAnalytics(1, 1, 1);
+    glm::vec2 mouse_pos(0, 0);
+
+    for (size_t frame = 0; frame < settings.num_frames; frame++) {
+      container.AdvanceOnFrame(mouse_pos);
+    }
+
+    const boid_sim::FrameAnalytics &analytics =
+        container.analytics()->latest();
+    REQUIRE(summaries[4].polarization == analytics.polarization);
+    REQUIRE(summaries[4].mean_neighbors == analytics.mean_neighbors);
+  }
+
+  SECTION("Results Do Not Depend on Thread Count") {
+    settings.num_threads = 1;
+    std::vector<boid_sim::headless::RunSummary> expected =
+        boid_sim::headless::EnsembleRunner(grid, settings).Run();
+
+    settings.num_threads = 4;
+    std::vector<boid_sim::headless::RunSummary> actual =
+        boid_sim::headless::EnsembleRunner(grid, settings).Run();
+
+    REQUIRE(actual.size() == expected.size());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+      REQUIRE(actual[i].run.index == i);
+      REQUIRE(actual[i].polarization == expected[i].polarization);
+      REQUIRE(actual[i].mean_neighbors == expected[i].mean_neighbors);
+      REQUIRE(actual[i].polarization >= 0.0f);
+      REQUIRE(actual[i].polarization <= 1.0f + 1e-5f);
+      REQUIRE(actual[i].mean_speed == Approx(2.0f));
+    }
+  }
+
+  SECTION("Only Keeps the Starting Swarms of Runs in Flight") {
+    settings.num_threads = 2;
+    boid_sim::headless::EnsembleRunner runner(grid, settings);
+    runner.Run();
+
+    // Swarms are freed after their last run, so at most one per thread is
+    // alive at any time
+    REQUIRE(runner.peak_live_swarms() >= 1);
+    REQUIRE(runner.peak_live_swarms() <= settings.num_threads);
+
+    settings.num_threads = 1;
+    boid_sim::headless::EnsembleRunner single(grid, settings);
+    single.Run();
+
+    REQUIRE(single.peak_live_swarms() == 1);
+  }
+
+  SECTION("Writes a CSV Row per Run") {
+    grid.cohesion_percents = {.95f};
+    settings.num_replicas = 1;
+    boid_sim::headless::EnsembleRunner runner(grid, settings);
+    std::stringstream csv;
+    boid_sim::headless::EnsembleRunner::WriteCsv(csv, runner.Run());
+
+    std::string line;
+    size_t num_lines = 0;
+    while (std::getline(csv, line)) {
+      num_lines++;
+    }
+
+    REQUIRE(num_lines == 1 + runner.runs().size());
+  }
+}
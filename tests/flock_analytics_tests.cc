@@ -0,0 +1,161 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+#include <numeric>
+
+#include "core/boid.h"
+#include "core/flock_analytics.h"
+#include "core/ring_buffer.h"
+#include "visualizer/boid_container.h"
+
+namespace {
+
+boid_sim::Boid MakeBoid(int id, float x, float y, float direction_x,
+                        float direction_y) {
+  glm::vec2 position(x, y);
+  glm::vec2 direction(direction_x, direction_y);
+
+  return boid_sim::Boid(id, position, direction, 2.0f, 10.0f);
+}
+
+} // namespace
+
+TEST_CASE("RingBuffer Tests") {
+  boid_sim::RingBuffer<int> buffer(2);
+  int item = 0;
+
+  REQUIRE_FALSE(buffer.Pop(item));
+  REQUIRE(buffer.Push(1));
+  REQUIRE(buffer.Push(2));
+  REQUIRE_FALSE(buffer.Push(3));
+  REQUIRE(buffer.num_dropped() == 1);
+  REQUIRE(buffer.size() == 2);
+
+  REQUIRE(buffer.Pop(item));
+  REQUIRE(item == 1);
+  REQUIRE(buffer.Push(4));
+  REQUIRE(buffer.Pop(item));
+  REQUIRE(item == 2);
+  REQUIRE(buffer.Pop(item));
+  REQUIRE(item == 4);
+  REQUIRE_FALSE(buffer.Pop(item));
+}
+
+TEST_CASE("Flock Analytics Tests") {
+  boid_sim::SpawnOptions options;
+  boid_sim::visualizer::BoidContainer container(200, 100, 0, options);
+  glm::vec2 mouse_pos(0, 0);
+
+  SECTION("Disabled by Default") { REQUIRE(container.analytics() == nullptr); }
+
+  SECTION("Separate Groups Are Separate Flocks") {
+    // A chain of 3 boids, a pair, and a loner, all flying right
+    std::vector<boid_sim::Boid> boids{
+        MakeBoid(0, 20, 20, 1, 0), MakeBoid(1, 28, 20, 1, 0),
+        MakeBoid(2, 36, 20, 1, 0), MakeBoid(3, 150, 80, 1, 0),
+        MakeBoid(4, 155, 80, 1, 0), MakeBoid(5, 100, 50, 1, 0)};
+    container.set_boids(boids);
+    container.EnableAnalytics(2, 1);
+    container.AdvanceOnFrame(mouse_pos);
+
+    boid_sim::FrameAnalytics frame;
+    REQUIRE(container.analytics()->buffer().Pop(frame));
+
+    REQUIRE(frame.frame == 0);
+    REQUIRE(frame.num_flocks == 2);
+    REQUIRE(frame.largest_flock == 3);
+    REQUIRE(frame.polarization == Approx(1.0f));
+    REQUIRE(frame.mean_speed == Approx(2.0f));
+    REQUIRE(frame.mean_neighbors == Approx(6.0f / 6.0f));
+    REQUIRE(frame.density == std::vector<float>{3.0f, 3.0f});
+  }
+
+  SECTION("Boids Seen From One Side Share a Flock") {
+    // Both fly right with a narrow cone, so only the boid behind sees the
+    // one ahead of it
+    std::vector<boid_sim::Boid> boids{MakeBoid(0, 28, 20, 1, 0),
+                                      MakeBoid(1, 20, 20, 1, 0)};
+    for (boid_sim::Boid &boid : boids) {
+      boid.set_view_angle(90.0f);
+    }
+
+    REQUIRE_FALSE(boids[0].vision_cone().Contains(boids[1].position()));
+    REQUIRE(boids[1].vision_cone().Contains(boids[0].position()));
+
+    container.set_boids(boids);
+    container.EnableAnalytics(1, 1);
+    container.AdvanceOnFrame(mouse_pos);
+
+    REQUIRE(container.analytics()->latest().num_flocks == 1);
+    REQUIRE(container.analytics()->latest().largest_flock == 2);
+  }
+
+  SECTION("Opposite Headings Cancel Out") {
+    std::vector<boid_sim::Boid> boids{MakeBoid(0, 20, 20, 1, 0),
+                                      MakeBoid(1, 150, 80, -1, 0)};
+    container.set_boids(boids);
+    container.EnableAnalytics(1, 1);
+    container.AdvanceOnFrame(mouse_pos);
+
+    REQUIRE(container.analytics()->latest().polarization ==
+            Approx(0.0f).margin(1e-6));
+    REQUIRE(container.analytics()->latest().num_flocks == 0);
+  }
+}
+
+TEST_CASE("Flock Analytics Match a Brute Force Pass") {
+  boid_sim::SpawnOptions options;
+  options.seed = 11;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+  boid_sim::FlockingParams params;
+  params.fov_radius = 25.0f;
+  glm::vec2 mouse_pos(0, 0);
+
+  boid_sim::visualizer::BoidContainer container(400, 300, 400, options,
+                                                params);
+  container.set_num_threads(4);
+  container.EnableAnalytics(8, 6);
+
+  std::vector<boid_sim::Boid> boids = container.boids();
+  container.AdvanceOnFrame(mouse_pos);
+  const boid_sim::FrameAnalytics &frame = container.analytics()->latest();
+
+  // Plain union-find over every pair
+  std::vector<size_t> parents(boids.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  std::function<size_t(size_t)> find = [&](size_t boid) {
+    return parents[boid] == boid ? boid : parents[boid] = find(parents[boid]);
+  };
+
+  size_t num_pairs = 0;
+  for (size_t i = 0; i < boids.size(); i++) {
+    for (size_t j = i + 1; j < boids.size(); j++) {
+      if (glm::distance(boids[i].position(), boids[j].position()) <
+          params.fov_radius) {
+        parents[find(j)] = find(i);
+        num_pairs++;
+      }
+    }
+  }
+
+  std::vector<size_t> sizes(boids.size(), 0);
+  for (size_t i = 0; i < boids.size(); i++) {
+    sizes[find(i)]++;
+  }
+
+  size_t num_flocks = 0;
+  size_t largest_flock = 0;
+  for (size_t size : sizes) {
+    if (size >= 2) {
+      num_flocks++;
+      largest_flock = std::max(largest_flock, size);
+    }
+  }
+
+  REQUIRE(frame.num_flocks == num_flocks);
+  REQUIRE(frame.largest_flock == largest_flock);
+  REQUIRE(frame.mean_neighbors == Approx(2.0f * num_pairs / boids.size()));
+  REQUIRE(std::accumulate(frame.density.begin(), frame.density.end(), 0.0f) ==
+          Approx(boids.size()));
+}
@@ -0,0 +1,92 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+#include <cstdint>
+
+#include "core/frame_arena.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("FrameArena Tests") {
+  boid_sim::FrameArena arena(1024);
+
+  SECTION("Takes No Memory Until Used") {
+    REQUIRE(arena.capacity() == 0);
+    REQUIRE(arena.used_bytes() == 0);
+  }
+
+  SECTION("Allocations Are Aligned and Apart") {
+    char *first = static_cast<char *>(arena.Allocate(3, 1));
+    double *second = static_cast<double *>(arena.Allocate(8, alignof(double)));
+    char *third = static_cast<char *>(arena.Allocate(16, 64));
+
+    REQUIRE(reinterpret_cast<uintptr_t>(second) % alignof(double) == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(third) % 64 == 0);
+    REQUIRE(reinterpret_cast<char *>(second) >= first + 3);
+    REQUIRE(third >= reinterpret_cast<char *>(second + 1));
+    REQUIRE(arena.capacity() == 1024);
+  }
+
+  SECTION("Reset Hands Back the Same Memory") {
+    void *first = arena.Allocate(100, 8);
+    arena.Reset();
+
+    REQUIRE(arena.used_bytes() == 0);
+    REQUIRE(arena.high_water_mark() == 100);
+    REQUIRE(arena.Allocate(100, 8) == first);
+  }
+
+  SECTION("Outgrown Arena Settles Into One Block") {
+    for (size_t i = 0; i < 10; i++) {
+      arena.Allocate(500, 8);
+    }
+    size_t capacity = arena.capacity();
+
+    REQUIRE(capacity >= 5000);
+    REQUIRE(arena.high_water_mark() >= 5000);
+
+    arena.Reset();
+    REQUIRE(arena.capacity() == capacity);
+
+    // The merged block fits the whole frame, so it never grows again
+    for (size_t frame = 0; frame < 3; frame++) {
+      for (size_t i = 0; i < 10; i++) {
+        arena.Allocate(500, 8);
+      }
+
+      REQUIRE(arena.capacity() == capacity);
+      arena.Reset();
+    }
+  }
+
+  SECTION("Backs Standard Containers") {
+    boid_sim::ArenaVector<int> values(
+        (boid_sim::ArenaAllocator<int>(&arena)));
+
+    for (int i = 0; i < 1000; i++) {
+      values.push_back(i);
+    }
+
+    REQUIRE(values[999] == 999);
+    REQUIRE(arena.used_bytes() >= 1000 * sizeof(int));
+  }
+}
+
+TEST_CASE("BoidContainer Frame Scratch") {
+  boid_sim::visualizer::BoidContainer container(800, 600, 500);
+  glm::vec2 mouse_pos(0, 0);
+
+  REQUIRE(container.scratch_high_water_mark() == 0);
+
+  container.AdvanceOnFrame(mouse_pos);
+  size_t high_water_mark = container.scratch_high_water_mark();
+
+  // At least the snapshot of every boid comes from the arenas
+  REQUIRE(high_water_mark >= 500 * sizeof(boid_sim::Boid));
+
+  for (size_t frame = 0; frame < 5; frame++) {
+    container.AdvanceOnFrame(mouse_pos);
+  }
+
+  REQUIRE(container.scratch_high_water_mark() >= high_water_mark);
+}
@@ -0,0 +1,166 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/frame_budget_controller.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("FrameBudgetController Tests") {
+  boid_sim::FrameBudgetController controller(16.0, 2);
+
+  SECTION("Starts at Full Quality") {
+    REQUIRE(controller.level() == 0);
+    REQUIRE(controller.settings().substeps == 2);
+    REQUIRE(controller.settings().max_neighbors ==
+            boid_sim::FidelitySettings::kUnlimited);
+  }
+
+  SECTION("Levels Get Cheaper") {
+    REQUIRE(controller.SettingsForLevel(1).substeps == 1);
+    REQUIRE(controller.SettingsForLevel(1).far_field_neighbor_threshold ==
+            boid_sim::FidelitySettings::kUnlimited);
+
+    for (size_t level = 2; level < controller.num_levels(); level++) {
+      boid_sim::FidelitySettings cheaper = controller.SettingsForLevel(level);
+      boid_sim::FidelitySettings previous =
+          controller.SettingsForLevel(level - 1);
+
+      REQUIRE(cheaper.substeps == 1);
+      REQUIRE(cheaper.far_field_neighbor_threshold <
+              previous.far_field_neighbor_threshold);
+      REQUIRE(cheaper.lod_neighbor_threshold <=
+              previous.lod_neighbor_threshold);
+      REQUIRE(cheaper.max_neighbors <= previous.max_neighbors);
+    }
+  }
+
+  SECTION("Degrades Over Budget") {
+    for (size_t frame = 0; frame < 10; frame++) {
+      controller.Update(40.0);
+    }
+
+    REQUIRE(controller.level() == 1);
+    REQUIRE(controller.settings().substeps == 1);
+
+    for (size_t frame = 0; frame < 200; frame++) {
+      controller.Update(40.0);
+    }
+
+    REQUIRE(controller.level() == controller.num_levels() - 1);
+  }
+
+  SECTION("Holds Still Inside the Hysteresis Band") {
+    for (size_t frame = 0; frame < 10; frame++) {
+      controller.Update(40.0);
+    }
+    size_t level = controller.level();
+
+    // Between the upgrade threshold and the budget nothing changes, even
+    // when the step time jitters
+    for (size_t frame = 0; frame < 500; frame++) {
+      controller.Update(frame % 2 == 0 ? 11.0 : 15.0);
+    }
+
+    REQUIRE(controller.level() == level);
+  }
+
+  SECTION("Does Not Oscillate Around the Target") {
+    // Steps that are cheap at one level and over budget at the next
+    for (size_t frame = 0; frame < 1000; frame++) {
+      controller.Update(controller.level() < 3 ? 20.0 : 14.0);
+    }
+
+    REQUIRE(controller.level() == 3);
+    REQUIRE(controller.num_changes() == 3);
+  }
+
+  SECTION("Recovers Well Under Budget") {
+    for (size_t frame = 0; frame < 30; frame++) {
+      controller.Update(40.0);
+    }
+    REQUIRE(controller.level() > 0);
+
+    for (size_t frame = 0; frame < 1000; frame++) {
+      controller.Update(2.0);
+    }
+
+    REQUIRE(controller.level() == 0);
+    REQUIRE(controller.settings().substeps == 2);
+  }
+
+  SECTION("Invalid Targets") {
+    REQUIRE_THROWS_AS(boid_sim::FrameBudgetController(0.0),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(boid_sim::FrameBudgetController(16.0, 0),
+                      std::invalid_argument);
+  }
+}
+
+TEST_CASE("Reduced Fidelity Stepping") {
+  glm::vec2 mouse_pos(0, 0);
+  boid_sim::SpawnOptions options;
+  options.seed = 40;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+  boid_sim::visualizer::BoidContainer full(500, 400, 400, options);
+
+  boid_sim::FidelitySettings cheapest =
+      boid_sim::FrameBudgetController(16.0)
+          .SettingsForLevel(boid_sim::FrameBudgetController(16.0).num_levels() -
+                            1);
+
+  SECTION("Same for Any Thread Count") {
+    boid_sim::visualizer::BoidContainer reduced = full;
+    reduced.set_fidelity(cheapest);
+    boid_sim::visualizer::BoidContainer threaded = reduced;
+    threaded.set_num_threads(4);
+
+    for (size_t frame = 0; frame < 20; frame++) {
+      full.AdvanceOnFrame(mouse_pos);
+      reduced.AdvanceOnFrame(mouse_pos);
+      threaded.AdvanceOnFrame(mouse_pos);
+    }
+
+    bool any_different = false;
+    for (size_t i = 0; i < full.boids().size(); i++) {
+      REQUIRE_FALSE(reduced.boids()[i] != threaded.boids()[i]);
+      any_different = any_different || full.boids()[i] != reduced.boids()[i];
+    }
+
+    REQUIRE(any_different);
+  }
+
+  SECTION("Substeps Cover the Same Distance") {
+    boid_sim::FidelitySettings fidelity;
+    fidelity.substeps = 4;
+    full.set_fidelity(fidelity);
+    std::vector<boid_sim::Boid> before = full.boids();
+
+    full.AdvanceOnFrame(mouse_pos);
+
+    for (size_t i = 0; i < before.size(); i++) {
+      float moved =
+          glm::distance(before[i].position(), full.boids()[i].position());
+      REQUIRE(moved <= before[i].max_speed() + 0.001f);
+      REQUIRE(moved > 0.0f);
+    }
+  }
+
+  SECTION("Frame Budget Reported Through Analytics") {
+    full.EnableAnalytics(4, 4);
+    full.EnableFrameBudget(1e-6);
+
+    for (size_t frame = 0; frame < 20; frame++) {
+      full.AdvanceOnFrame(mouse_pos);
+    }
+
+    const boid_sim::FrameAnalytics &analytics = full.analytics()->latest();
+    REQUIRE(analytics.quality_level > 0);
+    REQUIRE(analytics.fidelity == full.frame_budget()->SettingsForLevel(
+                                      analytics.quality_level));
+    REQUIRE(analytics.step_ms > 0.0);
+
+    full.DisableFrameBudget();
+    REQUIRE(full.fidelity() == boid_sim::FidelitySettings());
+  }
+}
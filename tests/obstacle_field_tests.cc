@@ -0,0 +1,131 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "core/obstacle_field.h"
+#include "visualizer/boid_container.h"
+
+namespace {
+
+bool InsideSquare(const glm::vec2 &point, float min, float max) {
+  return point.x > min && point.x < max && point.y > min && point.y < max;
+}
+
+} // namespace
+
+TEST_CASE("ReadObstacles Tests") {
+  std::string path = "obstacle_tests.txt";
+
+  SECTION("Reads Every Polygon") {
+    std::ofstream file(path);
+    file << "# two obstacles\n"
+         << "10 10 20 10 20 20 10 20\n"
+         << "\n"
+         << "50 50 60 50 55 60  # triangle\n";
+    file.close();
+
+    std::vector<std::vector<glm::vec2>> obstacles =
+        boid_sim::ReadObstacles(path);
+
+    REQUIRE(obstacles.size() == 2);
+    REQUIRE(obstacles[0].size() == 4);
+    REQUIRE(obstacles[1].size() == 3);
+    REQUIRE(obstacles[1][2] == glm::vec2(55, 60));
+  }
+
+  SECTION("Rejects Lines That Are Not Polygons") {
+    std::ofstream file(path);
+    file << "10 10 20 10 20\n";
+    file.close();
+
+    REQUIRE_THROWS_AS(boid_sim::ReadObstacles(path), std::invalid_argument);
+  }
+
+  SECTION("Rejects Coordinates That Are Not Numbers") {
+    std::ofstream file(path);
+    file << "10 10 20 10 20 twenty\n";
+    file.close();
+
+    REQUIRE_THROWS_AS(boid_sim::ReadObstacles(path), std::invalid_argument);
+  }
+
+  SECTION("Missing File") {
+    REQUIRE_THROWS_AS(boid_sim::ReadObstacles("no_such_obstacles.txt"),
+                      std::runtime_error);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST_CASE("ObstacleField Tests") {
+  std::vector<std::vector<float>> bounds{{0, 100}, {0, 100}};
+  std::vector<std::vector<glm::vec2>> square{
+      {{40, 40}, {60, 40}, {60, 60}, {40, 60}}};
+  boid_sim::ObstacleField field;
+  glm::vec2 gradient;
+
+  SECTION("Empty Field Is Far From Everything") {
+    REQUIRE(field.Sample(glm::vec2(5, 5), gradient) > 1e6f);
+    REQUIRE(gradient == glm::vec2(0, 0));
+  }
+
+  SECTION("Distances Around an Obstacle") {
+    field.Bake(square, bounds, 2.0f, false);
+
+    REQUIRE(field.Sample(glm::vec2(50, 50), gradient) ==
+            Approx(-10.0f).margin(0.5f));
+    REQUIRE(field.Sample(glm::vec2(30, 50), gradient) ==
+            Approx(10.0f).margin(0.5f));
+    REQUIRE(gradient.x < 0.0f);
+    REQUIRE(std::abs(gradient.y) < 0.1f);
+
+    // Without walls, the edge of the container is open space
+    REQUIRE(field.Sample(glm::vec2(2, 90), gradient) > 30.0f);
+  }
+
+  SECTION("Solid Walls") {
+    field.Bake(square, bounds, 2.0f, true);
+
+    REQUIRE(field.Sample(glm::vec2(3, 90), gradient) ==
+            Approx(3.0f).margin(0.5f));
+    REQUIRE(gradient.x > 0.0f);
+
+    // Past the edge of the grid the distance keeps falling
+    REQUIRE(field.Sample(glm::vec2(-5, 90), gradient) ==
+            Approx(-5.0f).margin(0.5f));
+  }
+
+  SECTION("Rejects Non-Positive Cell Sizes") {
+    REQUIRE_THROWS_AS(field.Bake(square, bounds, 0.0f, true),
+                      std::invalid_argument);
+  }
+}
+
+TEST_CASE("Boids Steer Around Obstacles") {
+  boid_sim::SpawnOptions options;
+  options.seed = 3;
+  options.distribution = boid_sim::SpawnDistribution::kRing;
+  boid_sim::visualizer::BoidContainer container(400, 400, 150, options);
+  glm::vec2 mouse_pos(0, 0);
+
+  std::vector<std::vector<glm::vec2>> obstacles{
+      {{150, 150}, {250, 150}, {250, 250}, {150, 250}}};
+  container.SetObstacles(obstacles);
+  REQUIRE(container.obstacle_field() != nullptr);
+
+  for (size_t frame = 0; frame < 400; frame++) {
+    container.AdvanceOnFrame(mouse_pos);
+
+    for (const boid_sim::Boid &boid : container.boids()) {
+      REQUIRE_FALSE(InsideSquare(boid.position(), 155, 245));
+      REQUIRE(InsideSquare(boid.position(), -10, 410));
+    }
+  }
+
+  container.ClearObstacles();
+  REQUIRE(container.obstacle_field() == nullptr);
+}
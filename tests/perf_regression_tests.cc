@@ -0,0 +1,292 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <new>
+#include <sstream>
+
+#include "visualizer/boid_container.h"
+
+#ifndef BOID_SIM_PERF_BASELINE
+#define BOID_SIM_PERF_BASELINE "tests/perf_baseline.txt"
+#endif
+
+/*
+ * Every allocation in the test binary goes through here so the perf tests can
+ * tell how many allocations a frame makes. The standard library's own operator
+ * delete already releases memory with free, so it is left alone.
+ */
+namespace {
+
+std::atomic<size_t> num_allocations(0);
+
+} // namespace
+
+void *operator new(size_t size) {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+
+  void *memory = std::malloc(size == 0 ? 1 : size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  return memory;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+namespace {
+
+struct PerfWorkload {
+  std::string name;
+  size_t width;
+  size_t height;
+  size_t num_boids;
+  boid_sim::SpawnDistribution distribution;
+  size_t num_frames;
+  size_t num_threads;
+  bool unbounded;
+};
+
+struct PerfSample {
+  double ms_per_frame = 0.0;
+  double allocations_per_frame = 0.0;
+};
+
+// Fraction a measurement may grow past its baseline, read from the environment
+double Tolerance(const char *variable, double fallback) {
+  const char *value = std::getenv(variable);
+  return value == nullptr ? fallback : std::atof(value);
+}
+
+/*
+ * Steps a seeded swarm and reports the median frame time, which shrugs off
+ * the odd frame lost to the scheduler, and the mean allocations.
+ */
+PerfSample Measure(const PerfWorkload &workload) {
+  boid_sim::SpawnOptions spawn_options;
+  spawn_options.seed = 1234;
+  spawn_options.distribution = workload.distribution;
+
+  boid_sim::visualizer::BoidContainer container(
+      workload.width, workload.height, workload.num_boids, spawn_options);
+  container.set_num_threads(workload.num_threads);
+  container.set_unbounded(workload.unbounded);
+  glm::vec2 mouse_pos(0, 0);
+
+  // The first frame sizes every reused buffer
+  container.AdvanceOnFrame(mouse_pos);
+
+  std::vector<double> frame_ms;
+  frame_ms.reserve(workload.num_frames);
+  size_t allocations_before = num_allocations.load();
+
+  for (size_t frame = 0; frame < workload.num_frames; frame++) {
+    auto start = std::chrono::steady_clock::now();
+    container.AdvanceOnFrame(mouse_pos);
+    auto end = std::chrono::steady_clock::now();
+
+    frame_ms.push_back(
+        std::chrono::duration<double, std::milli>(end - start).count());
+  }
+
+  size_t allocations = num_allocations.load() - allocations_before;
+  std::sort(frame_ms.begin(), frame_ms.end());
+
+  // Rounded to the two decimals the baseline file keeps
+  PerfSample sample;
+  sample.ms_per_frame = std::round(frame_ms[frame_ms.size() / 2] * 100) / 100;
+  sample.allocations_per_frame =
+      std::round((double)allocations / (double)workload.num_frames * 100) /
+      100;
+
+  return sample;
+}
+
+std::map<std::string, PerfSample> ReadBaseline(const std::string &path) {
+  std::map<std::string, PerfSample> baseline;
+  std::ifstream file(path);
+  std::string line;
+
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::istringstream fields(line);
+    std::string name;
+    PerfSample sample;
+
+    if (fields >> name >> sample.ms_per_frame >>
+        sample.allocations_per_frame) {
+      baseline[name] = sample;
+    }
+  }
+
+  return baseline;
+}
+
+void WriteBaseline(const std::string &path,
+                   const std::vector<PerfWorkload> &workloads,
+                   const std::vector<PerfSample> &samples) {
+  std::ofstream file(path);
+  file << "# Perf regression baseline, refresh with BOID_SIM_PERF_UPDATE=1\n";
+  file << "# workload ms_per_frame allocations_per_frame\n";
+  file << std::fixed << std::setprecision(2);
+
+  for (size_t i = 0; i < workloads.size(); i++) {
+    file << workloads[i].name << " " << samples[i].ms_per_frame << " "
+         << samples[i].allocations_per_frame << "\n";
+  }
+}
+
+// Appends one row to the report and returns whether it is within the limit
+bool CompareMetric(std::ostringstream &report, const std::string &workload,
+                   const std::string &metric, double baseline,
+                   double measured, double tolerance) {
+  double change = baseline > 0.0 ? measured / baseline - 1.0
+                                 : (measured > 0.0 ? 1.0 : 0.0);
+  bool passed = measured <= baseline * (1.0 + tolerance);
+
+  report << std::left << std::setw(16) << workload << std::setw(14) << metric
+         << std::right << std::fixed << std::setprecision(2) << std::setw(12)
+         << baseline << std::setw(12) << measured << std::showpos
+         << std::setw(9) << change * 100.0 << "%" << std::setw(8)
+         << tolerance * 100.0 << "%" << std::noshowpos
+         << (passed ? "" : "  REGRESSED") << "\n";
+
+  return passed;
+}
+
+std::vector<PerfWorkload> PerfWorkloads() {
+  return {{"sparse_1k", 4000, 4000, 1000,
+           boid_sim::SpawnDistribution::kUniform, 50, 1, false},
+          {"clustered_10k", 8000, 8000, 10000,
+           boid_sim::SpawnDistribution::kClustered, 3, 1, false},
+          {"threaded_10k", 8000, 8000, 10000,
+           boid_sim::SpawnDistribution::kClustered, 3, 4, false},
+          {"unbounded_1k", 4000, 4000, 1000,
+           boid_sim::SpawnDistribution::kUniform, 50, 1, true},
+          {"uniform_100k", 8000, 8000, 100000,
+           boid_sim::SpawnDistribution::kUniform, 3, 1, false}};
+}
+
+void WriteReportHeader(std::ostringstream &report) {
+  report << std::left << std::setw(16) << "workload" << std::setw(14)
+         << "metric" << std::right << std::setw(12) << "baseline"
+         << std::setw(12) << "measured" << std::setw(10) << "change"
+         << std::setw(9) << "limit" << "\n";
+}
+
+// Appends a row for a workload missing from the baseline
+bool ReportMissing(std::ostringstream &report, const std::string &workload) {
+  report << std::left << std::setw(16) << workload
+         << "missing from the baseline\n";
+
+  return false;
+}
+
+} // namespace
+
+/*
+ * Checks that the smaller workloads allocate no more per frame than
+ * tests/perf_baseline.txt allows, give or take BOID_SIM_ALLOC_TOLERANCE
+ * (default 0). Allocation counts are the same on every machine, so this runs
+ * with the rest of the tests.
+ */
+TEST_CASE("AdvanceOnFrame Allocation Regression", "[alloc]") {
+  std::vector<PerfWorkload> workloads = PerfWorkloads();
+  std::map<std::string, PerfSample> baseline =
+      ReadBaseline(BOID_SIM_PERF_BASELINE);
+  double allocation_tolerance = Tolerance("BOID_SIM_ALLOC_TOLERANCE", 0.0);
+
+  std::ostringstream report;
+  WriteReportHeader(report);
+  bool passed = true;
+
+  for (size_t i = 0; i < workloads.size(); i++) {
+    const std::string &name = workloads[i].name;
+
+    // The 100k workload only adds run time, so it is left to the timed test
+    if (workloads[i].num_boids >= 100000) {
+      continue;
+    }
+
+    if (baseline.find(name) == baseline.end()) {
+      passed = ReportMissing(report, name);
+      continue;
+    }
+
+    PerfSample sample = Measure(workloads[i]);
+    passed &= CompareMetric(report, name, "allocs/frame",
+                            baseline[name].allocations_per_frame,
+                            sample.allocations_per_frame,
+                            allocation_tolerance);
+  }
+
+  INFO(report.str());
+  REQUIRE(passed);
+}
+
+/*
+ * Times AdvanceOnFrame on fixed workloads against tests/perf_baseline.txt.
+ * Times may grow by BOID_SIM_PERF_TOLERANCE (default 0.5, so 50%) and
+ * allocations by BOID_SIM_ALLOC_TOLERANCE (default 0) before the test fails.
+ * Times depend on the machine and how busy it is, so the test is hidden and
+ * only runs when asked for with [perf]. Running with BOID_SIM_PERF_UPDATE=1
+ * rewrites the baseline instead, and the refresh-perf-baseline target does
+ * that for every workload.
+ */
+TEST_CASE("AdvanceOnFrame Perf Regression", "[.perf]") {
+  std::vector<PerfWorkload> workloads = PerfWorkloads();
+
+  std::vector<PerfSample> samples;
+  for (const PerfWorkload &workload : workloads) {
+    samples.push_back(Measure(workload));
+  }
+
+  if (std::getenv("BOID_SIM_PERF_UPDATE") != nullptr) {
+    WriteBaseline(BOID_SIM_PERF_BASELINE, workloads, samples);
+    WARN("Wrote perf baseline to " BOID_SIM_PERF_BASELINE);
+    return;
+  }
+
+  std::map<std::string, PerfSample> baseline =
+      ReadBaseline(BOID_SIM_PERF_BASELINE);
+  double time_tolerance = Tolerance("BOID_SIM_PERF_TOLERANCE", 0.5);
+  double allocation_tolerance = Tolerance("BOID_SIM_ALLOC_TOLERANCE", 0.0);
+
+  std::ostringstream report;
+  WriteReportHeader(report);
+  bool passed = true;
+
+  for (size_t i = 0; i < workloads.size(); i++) {
+    const std::string &name = workloads[i].name;
+
+    if (baseline.find(name) == baseline.end()) {
+      passed = ReportMissing(report, name);
+      continue;
+    }
+
+    passed &= CompareMetric(report, name, "ms/frame",
+                            baseline[name].ms_per_frame,
+                            samples[i].ms_per_frame, time_tolerance);
+    passed &= CompareMetric(report, name, "allocs/frame",
+                            baseline[name].allocations_per_frame,
+                            samples[i].allocations_per_frame,
+                            allocation_tolerance);
+  }
+
+  INFO(report.str());
+  INFO("Refresh with BOID_SIM_PERF_UPDATE=1 or the refresh-perf-baseline "
+       "target if the change is expected");
+  REQUIRE(passed);
+}
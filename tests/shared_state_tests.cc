@@ -0,0 +1,196 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <random>
+#include <thread>
+
+#include "core/boid_record.h"
+#include "core/shared_state.h"
+#include "visualizer/boid_container.h"
+
+namespace {
+
+/*
+ * Shared memory name no other test run is using
+ */
+std::string UniqueName() {
+  std::random_device rd;
+  return "/boid-sim-test-" + std::to_string(rd());
+}
+
+bool SameRecord(const boid_sim::BoidRecord &record1,
+                const boid_sim::BoidRecord &record2) {
+  return std::memcmp(&record1, &record2, sizeof(boid_sim::BoidRecord)) == 0;
+}
+
+/*
+ * Follows the writer until it publishes last_frame. Every frame's boids all
+ * have the frame number as their x and their index as their y, so a frame
+ * mixing two writes shows up as boids that disagree.
+ */
+void FollowWriter(const std::string &name, size_t num_boids,
+                  uint64_t last_frame, std::atomic<size_t> &num_torn,
+                  std::atomic<size_t> &num_frames_read) {
+  boid_sim::SharedStateReader reader(name);
+  boid_sim::SharedFrame frame;
+  uint64_t previous_frame = 0;
+
+  while (previous_frame < last_frame) {
+    if (!reader.ReadLatest(frame)) {
+      continue;
+    }
+
+    bool torn = frame.frame < previous_frame ||
+                frame.boids.size() != num_boids;
+    for (size_t i = 0; i < frame.boids.size(); i++) {
+      torn = torn || frame.boids[i].position[0] != (float)frame.frame ||
+             frame.boids[i].position[1] != (float)i;
+    }
+
+    if (torn) {
+      num_torn++;
+    }
+
+    previous_frame = frame.frame;
+    num_frames_read++;
+  }
+}
+
+} // namespace
+
+TEST_CASE("Shared State Round Trip") {
+  std::string name = UniqueName();
+  boid_sim::visualizer::BoidContainer container(400, 300, 50);
+  boid_sim::SharedStateWriter writer(name, 50, 3);
+  boid_sim::SharedStateReader reader(name);
+  boid_sim::SharedFrame frame;
+
+  REQUIRE(reader.capacity() == 50);
+  REQUIRE_FALSE(reader.ReadLatest(frame));
+
+  for (uint64_t frame_number = 1; frame_number <= 5; frame_number++) {
+    writer.Publish(frame_number, container.container_bounds(),
+                   container.boids());
+  }
+
+  REQUIRE(reader.num_published() == 5);
+  REQUIRE(reader.ReadLatest(frame));
+  REQUIRE(frame.frame == 5);
+  REQUIRE(frame.container_bounds[0][1] == 400.0f);
+  REQUIRE(frame.container_bounds[1][1] == 300.0f);
+  REQUIRE(frame.boids.size() == 50);
+
+  for (size_t i = 0; i < 50; i++) {
+    REQUIRE(SameRecord(frame.boids[i],
+                       boid_sim::ToRecord(container.boids()[i])));
+  }
+}
+
+TEST_CASE("Shared State Writer and Readers Run Concurrently") {
+  std::string name = UniqueName();
+  size_t num_boids = 2000;
+  uint64_t last_frame = 3000;
+
+  // Two slots, so readers regularly get lapped and have to retry
+  boid_sim::SharedStateWriter writer(name, num_boids, 2);
+
+  std::vector<boid_sim::Boid> boids;
+  for (size_t i = 0; i < num_boids; i++) {
+    glm::vec2 position(0, (float)i);
+    glm::vec2 direction(1, 0);
+    boids.push_back(boid_sim::Boid((int)i, position, direction));
+  }
+
+  std::atomic<size_t> num_torn(0);
+  std::atomic<size_t> num_frames_read(0);
+  std::vector<std::thread> readers;
+  for (size_t reader = 0; reader < 2; reader++) {
+    readers.push_back(std::thread(FollowWriter, name, num_boids, last_frame,
+                                  std::ref(num_torn),
+                                  std::ref(num_frames_read)));
+  }
+
+  std::vector<std::vector<float>> container_bounds{{0, 100}, {0, 100}};
+  for (uint64_t frame = 1; frame <= last_frame; frame++) {
+    for (size_t i = 0; i < num_boids; i++) {
+      boids[i].set_position(glm::vec2((float)frame, (float)i));
+    }
+
+    writer.Publish(frame, container_bounds, boids);
+  }
+
+  for (std::thread &reader : readers) {
+    reader.join();
+  }
+
+  REQUIRE(writer.num_published() == last_frame);
+  REQUIRE(num_frames_read > 0);
+  REQUIRE(num_torn == 0);
+}
+
+TEST_CASE("BoidContainer Exports Every Frame") {
+  std::string name = UniqueName();
+  glm::vec2 mouse_pos(0, 0);
+  boid_sim::visualizer::BoidContainer container(400, 300, 40);
+  container.EnableStateExport(name);
+
+  for (size_t frame = 0; frame < 3; frame++) {
+    container.AdvanceOnFrame(mouse_pos);
+  }
+
+  boid_sim::SharedStateReader reader(name);
+  boid_sim::SharedFrame frame;
+  REQUIRE(reader.ReadLatest(frame));
+  REQUIRE(frame.frame == container.frame_count());
+  REQUIRE(frame.boids.size() == 40);
+
+  for (size_t i = 0; i < 40; i++) {
+    REQUIRE(SameRecord(frame.boids[i],
+                       boid_sim::ToRecord(container.boids()[i])));
+  }
+
+  SECTION("A Bigger Swarm Gets a New Segment") {
+    container.AddPredators(2);
+    container.AdvanceOnFrame(mouse_pos);
+
+    REQUIRE(reader.writer_closed());
+
+    boid_sim::SharedStateReader new_reader(name);
+    REQUIRE(new_reader.ReadLatest(frame));
+    REQUIRE(frame.boids.size() == 42);
+    REQUIRE(frame.frame == container.frame_count());
+  }
+
+  SECTION("Disabling Removes the Segment") {
+    container.DisableStateExport();
+
+    REQUIRE(container.state_writer() == nullptr);
+    REQUIRE(reader.writer_closed());
+    REQUIRE_THROWS_AS(boid_sim::SharedStateReader(name), std::runtime_error);
+  }
+}
+
+TEST_CASE("Shared State Errors") {
+  std::string name = UniqueName();
+
+  SECTION("No Segment To Read") {
+    REQUIRE_THROWS_AS(boid_sim::SharedStateReader(name), std::runtime_error);
+  }
+
+  SECTION("No Slots") {
+    REQUIRE_THROWS_AS(boid_sim::SharedStateWriter(name, 10, 0),
+                      std::invalid_argument);
+  }
+
+  SECTION("More Boids Than the Capacity") {
+    boid_sim::visualizer::BoidContainer container(100, 100, 11);
+    boid_sim::SharedStateWriter writer(name, 10);
+
+    REQUIRE_THROWS_AS(
+        writer.Publish(1, container.container_bounds(), container.boids()),
+        std::invalid_argument);
+  }
+}
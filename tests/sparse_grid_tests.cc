@@ -0,0 +1,162 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cmath>
+
+#include "core/boid.h"
+#include "core/boid_record.h"
+#include "core/sparse_grid.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("SparseGrid Tests") {
+  std::vector<glm::vec2> positions{{5, 5},        {15, 5},        {-5, -5},
+                                   {50, 25},      {52, 27},       {5, 7},
+                                   {1e6f, -1e6f}, {1e6f, -1e6f + 3}};
+  boid_sim::SparseGrid grid;
+  grid.Build(positions, 10.0f);
+
+  SECTION("Only Occupied Cells Are Stored") {
+    REQUIRE(grid.num_cells() == 5);
+    REQUIRE(grid.entries().size() == positions.size());
+    REQUIRE(grid.capacity() >= 2 * grid.num_cells());
+  }
+
+  SECTION("Cells Keep Ascending Index Order") {
+    size_t cell = grid.CellOf(glm::vec2(5, 5));
+    std::vector<size_t> indices(
+        grid.entries().begin() + grid.cell_starts()[cell],
+        grid.entries().begin() + grid.cell_starts()[cell + 1]);
+
+    REQUIRE(indices == std::vector<size_t>{0, 5});
+  }
+
+  SECTION("Empty Cells Are Not Found") {
+    REQUIRE(grid.CellOf(glm::vec2(500, 500)) == grid.num_cells());
+  }
+
+  SECTION("Gather Finds Every Position in Range") {
+    std::vector<size_t> indices;
+    grid.Gather(glm::vec2(0, 0), 8.0f, indices);
+    std::sort(indices.begin(), indices.end());
+
+    REQUIRE(indices == std::vector<size_t>{0, 2, 5});
+
+    grid.Gather(glm::vec2(1e6f, -1e6f), 5.0f, indices);
+    std::sort(indices.begin(), indices.end());
+
+    REQUIRE(indices == std::vector<size_t>{6, 7});
+  }
+
+  SECTION("Huge Radius Falls Back to Scanning Cells") {
+    std::vector<size_t> indices;
+    grid.Gather(glm::vec2(0, 0), 1e7f, indices);
+
+    REQUIRE(indices.size() == positions.size());
+  }
+
+  SECTION("Rebuilding Forgets Old Cells") {
+    std::vector<glm::vec2> moved{{-95, 300}, {-91, 301}};
+    grid.Build(moved, 10.0f);
+
+    std::vector<size_t> indices;
+    grid.Gather(glm::vec2(5, 5), 10.0f, indices);
+    REQUIRE(indices.empty());
+
+    grid.Gather(glm::vec2(-93, 300), 5.0f, indices);
+    std::sort(indices.begin(), indices.end());
+    REQUIRE(indices == std::vector<size_t>{0, 1});
+  }
+
+  SECTION("Matches Brute Force Over Many Cells") {
+    std::vector<glm::vec2> scattered;
+    for (size_t i = 0; i < 2000; i++) {
+      float angle = (float)i * 2.39996f;
+      float radius = std::sqrt((float)i) * 40.0f;
+      scattered.emplace_back(radius * std::cos(angle),
+                             radius * std::sin(angle));
+    }
+    grid.Build(scattered, 25.0f);
+
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < scattered.size(); i += 37) {
+      grid.Gather(scattered[i], 25.0f, indices);
+
+      for (size_t j = 0; j < scattered.size(); j++) {
+        if (glm::distance(scattered[i], scattered[j]) < 25.0f) {
+          REQUIRE(std::find(indices.begin(), indices.end(), j) !=
+                  indices.end());
+        }
+      }
+    }
+  }
+
+  SECTION("NaN Positions Do Not Break the Build") {
+    std::vector<glm::vec2> broken{{NAN, 3}, {2, 3}};
+    grid.Build(broken, 10.0f);
+
+    REQUIRE(grid.entries().size() == 2);
+  }
+}
+
+TEST_CASE("Unbounded Worlds") {
+  size_t num_frames = 300;
+  glm::vec2 mouse_pos(0, 0);
+  boid_sim::SpawnOptions options;
+  options.seed = 99;
+
+  // Reference: every boid checks every other boid with no bounds at all
+  boid_sim::visualizer::BoidContainer reference(200, 200, 60, options);
+  std::vector<boid_sim::Boid> expected = reference.boids();
+  boid_sim::FlockingParams params = reference.flocking_params();
+  std::vector<std::vector<float>> no_bounds;
+
+  for (size_t frame = 0; frame < num_frames; frame++) {
+    std::vector<boid_sim::Boid> snapshot = expected;
+
+    for (boid_sim::Boid &boid : expected) {
+      boid.UpdatePosition(no_bounds, snapshot, mouse_pos, params.align_percent,
+                          params.cohesion_percent, params.separation_percent);
+    }
+  }
+
+  SECTION("Stepping Matches the Brute Force Reference") {
+    for (size_t num_threads : {1, 4}) {
+      boid_sim::visualizer::BoidContainer container(200, 200, 60, options);
+      container.set_unbounded(true);
+      container.set_num_threads(num_threads);
+
+      for (size_t frame = 0; frame < num_frames; frame++) {
+        container.AdvanceOnFrame(mouse_pos);
+      }
+
+      REQUIRE(container.uses_sparse_grid());
+      REQUIRE(boid_sim::HashSwarm(container.boids()) ==
+              boid_sim::HashSwarm(expected));
+    }
+  }
+
+  SECTION("Boids Roam Past the Spawn Area") {
+    size_t num_outside = 0;
+    for (const boid_sim::Boid &boid : expected) {
+      if (boid.position().x < 0 || boid.position().x > 200 ||
+          boid.position().y < 0 || boid.position().y > 200) {
+        num_outside++;
+      }
+    }
+
+    REQUIRE(num_outside > 0);
+  }
+
+  SECTION("Huge Bounded Worlds Switch to the Sparse Grid") {
+    boid_sim::visualizer::BoidContainer container(1000000, 1000000, 100,
+                                                  options);
+    container.AdvanceOnFrame(mouse_pos);
+    REQUIRE(container.uses_sparse_grid());
+
+    boid_sim::visualizer::BoidContainer window(800, 600, 100, options);
+    window.AdvanceOnFrame(mouse_pos);
+    REQUIRE_FALSE(window.uses_sparse_grid());
+  }
+}
@@ -0,0 +1,84 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <algorithm>
+#include <catch2/catch.hpp>
+
+#include "core/boid.h"
+#include "core/boid_record.h"
+#include "core/spatial_grid.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("SpatialGrid Tests") {
+  std::vector<std::vector<float>> container_bounds{{0, 100}, {0, 50}};
+  std::vector<glm::vec2> positions{{5, 5},    {15, 5},  {95, 45},
+                                   {-30, 70}, {50, 25}, {52, 27}};
+  boid_sim::SpatialGrid grid;
+  grid.Build(positions, container_bounds, 10.0f);
+
+  SECTION("Grid Dimensions") {
+    REQUIRE(grid.columns() == 10);
+    REQUIRE(grid.rows() == 5);
+    REQUIRE(grid.entries().size() == positions.size());
+  }
+
+  SECTION("Out of Bounds Positions Clamp to Edge Cells") {
+    REQUIRE(grid.CellOf(glm::vec2(-30, 70)) == grid.CellOf(glm::vec2(0, 49)));
+  }
+
+  SECTION("Gather Finds Every Position in Range") {
+    std::vector<size_t> indices;
+    grid.Gather(glm::vec2(51, 26), 5.0f, indices);
+    std::sort(indices.begin(), indices.end());
+
+    REQUIRE(indices == std::vector<size_t>{4, 5});
+
+    grid.Gather(glm::vec2(8, 5), 10.0f, indices);
+    std::sort(indices.begin(), indices.end());
+
+    REQUIRE(indices == std::vector<size_t>{0, 1});
+  }
+
+  SECTION("Threaded Build Holds the Same Cells") {
+    boid_sim::SpatialGrid threaded_grid;
+    threaded_grid.Build(positions, container_bounds, 10.0f, 4);
+
+    REQUIRE(threaded_grid.cell_starts() == grid.cell_starts());
+  }
+}
+
+TEST_CASE("Deterministic Stepping Is Independent of Thread Count") {
+  size_t num_frames = 30;
+  glm::vec2 mouse_pos(200, 150);
+  boid_sim::SpawnOptions options;
+  options.seed = 2026;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+
+  // Reference: every boid checks every other boid, one thread
+  boid_sim::visualizer::BoidContainer reference(400, 300, 300, options);
+  std::vector<boid_sim::Boid> expected = reference.boids();
+  boid_sim::FlockingParams params = reference.flocking_params();
+  std::vector<std::vector<float>> bounds = reference.container_bounds();
+
+  for (size_t frame = 0; frame < num_frames; frame++) {
+    std::vector<boid_sim::Boid> snapshot = expected;
+
+    for (boid_sim::Boid &boid : expected) {
+      boid.UpdatePosition(bounds, snapshot, mouse_pos, params.align_percent,
+                          params.cohesion_percent, params.separation_percent);
+    }
+  }
+
+  uint64_t expected_hash = boid_sim::HashSwarm(expected);
+
+  for (size_t num_threads : {1, 2, 8, 32}) {
+    boid_sim::visualizer::BoidContainer container(400, 300, 300, options);
+    container.set_num_threads(num_threads);
+
+    for (size_t frame = 0; frame < num_frames; frame++) {
+      container.AdvanceOnFrame(mouse_pos);
+    }
+
+    REQUIRE(boid_sim::HashSwarm(container.boids()) == expected_hash);
+  }
+}
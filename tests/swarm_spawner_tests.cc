@@ -0,0 +1,175 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/boid.h"
+#include "core/swarm_rng.h"
+#include "core/swarm_spawner.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("SwarmRng Tests") {
+  boid_sim::SwarmRng rng(42);
+
+  SECTION("Same Counter and Slot Give Same Value") {
+    REQUIRE(rng.Bits(7, 1) == boid_sim::SwarmRng(42).Bits(7, 1));
+  }
+
+  SECTION("Counters, Slots and Seeds Are Independent Streams") {
+    REQUIRE(rng.Bits(7, 1) != rng.Bits(8, 1));
+    REQUIRE(rng.Bits(7, 1) != rng.Bits(7, 2));
+    REQUIRE(rng.Bits(7, 1) != boid_sim::SwarmRng(43).Bits(7, 1));
+  }
+
+  SECTION("Uniform Range") {
+    for (uint64_t counter = 0; counter < 1000; counter++) {
+      float value = rng.Uniform(counter, 0, -2.0f, 3.0f);
+
+      REQUIRE(value >= -2.0f);
+      REQUIRE(value < 3.0f);
+    }
+  }
+
+  SECTION("Reserve Advances Counter") {
+    REQUIRE(rng.Reserve(10) == 0);
+    REQUIRE(rng.Reserve(5) == 10);
+    REQUIRE(rng.counter() == 15);
+  }
+}
+
+TEST_CASE("SpawnSwarm Tests") {
+  std::vector<std::vector<float>> container_bounds{{0, 400}, {0, 200}};
+  size_t num_boids = 500;
+  float max_speed = 2.0f;
+  float fov_radius = 85.0f;
+  boid_sim::SpawnOptions options;
+  options.seed = 1234;
+
+  SECTION("Same Seed Gives Same Swarm for Any Thread Count") {
+    std::vector<boid_sim::SpawnDistribution> distributions{
+        boid_sim::SpawnDistribution::kUniform,
+        boid_sim::SpawnDistribution::kClustered,
+        boid_sim::SpawnDistribution::kRing};
+
+    for (boid_sim::SpawnDistribution distribution : distributions) {
+      options.distribution = distribution;
+      options.num_threads = 1;
+      boid_sim::SwarmRng rng(options.seed);
+      std::vector<boid_sim::Boid> expected;
+      boid_sim::SpawnSwarm(container_bounds, num_boids, options, max_speed,
+                           fov_radius, rng, expected);
+
+      for (size_t num_threads : {2, 3, 8}) {
+        options.num_threads = num_threads;
+        boid_sim::SwarmRng other_rng(options.seed);
+        std::vector<boid_sim::Boid> actual;
+        boid_sim::SpawnSwarm(container_bounds, num_boids, options, max_speed,
+                             fov_radius, other_rng, actual);
+
+        REQUIRE(actual.size() == expected.size());
+
+        for (size_t i = 0; i < expected.size(); i++) {
+          REQUIRE_FALSE(expected[i] != actual[i]);
+        }
+      }
+    }
+  }
+
+  SECTION("Different Seeds Give Different Swarms") {
+    boid_sim::SwarmRng rng(1);
+    boid_sim::SwarmRng other_rng(2);
+    std::vector<boid_sim::Boid> swarm;
+    std::vector<boid_sim::Boid> other_swarm;
+    boid_sim::SpawnSwarm(container_bounds, num_boids, options, max_speed,
+                         fov_radius, rng, swarm);
+    boid_sim::SpawnSwarm(container_bounds, num_boids, options, max_speed,
+                         fov_radius, other_rng, other_swarm);
+
+    REQUIRE(swarm[0].position() != other_swarm[0].position());
+  }
+
+  SECTION("Uniform Swarm Stays in Bounds") {
+    boid_sim::SwarmRng rng(options.seed);
+    std::vector<boid_sim::Boid> swarm;
+    boid_sim::SpawnSwarm(container_bounds, num_boids, options, max_speed,
+                         fov_radius, rng, swarm);
+
+    for (size_t i = 0; i < swarm.size(); i++) {
+      REQUIRE(swarm[i].id() == (int)i);
+      REQUIRE(swarm[i].position().x >= 0.0f);
+      REQUIRE(swarm[i].position().x <= 400.0f);
+      REQUIRE(swarm[i].position().y >= 0.0f);
+      REQUIRE(swarm[i].position().y <= 200.0f);
+      REQUIRE(glm::length(swarm[i].velocity()) == Approx(max_speed));
+    }
+  }
+
+  SECTION("Ring Swarm Sits in the Ring Band") {
+    options.distribution = boid_sim::SpawnDistribution::kRing;
+    boid_sim::SwarmRng rng(options.seed);
+    std::vector<boid_sim::Boid> swarm;
+    boid_sim::SpawnSwarm(container_bounds, num_boids, options, max_speed,
+                         fov_radius, rng, swarm);
+
+    glm::vec2 center(200, 100);
+    float min_radius = 200.0f * (options.ring_radius - options.ring_width);
+    float max_radius = 200.0f * (options.ring_radius + options.ring_width);
+
+    for (const boid_sim::Boid &boid : swarm) {
+      float radius = glm::distance(center, boid.position());
+
+      REQUIRE(radius >= min_radius);
+      REQUIRE(radius <= max_radius);
+    }
+  }
+
+  SECTION("Clustered Swarm Is Denser Than Uniform") {
+    options.distribution = boid_sim::SpawnDistribution::kClustered;
+    options.num_clusters = 1;
+    boid_sim::SwarmRng rng(options.seed);
+    std::vector<boid_sim::Boid> swarm;
+    boid_sim::SpawnSwarm(container_bounds, num_boids, options, max_speed,
+                         fov_radius, rng, swarm);
+
+    glm::vec2 mean(0, 0);
+    for (const boid_sim::Boid &boid : swarm) {
+      mean += boid.position();
+    }
+    mean /= (float)swarm.size();
+
+    size_t near_mean = 0;
+    for (const boid_sim::Boid &boid : swarm) {
+      if (glm::distance(mean, boid.position()) < 40.0f) {
+        near_mean++;
+      }
+    }
+
+    // A uniform swarm would put about 6% of the boids in that circle
+    REQUIRE(near_mean > num_boids / 2);
+  }
+
+  SECTION("Appends After Existing Boids") {
+    boid_sim::SwarmRng rng(options.seed);
+    std::vector<boid_sim::Boid> swarm;
+    boid_sim::SpawnSwarm(container_bounds, 10, options, max_speed, fov_radius,
+                         rng, swarm);
+    boid_sim::SpawnSwarm(container_bounds, 10, options, max_speed, fov_radius,
+                         rng, swarm);
+
+    REQUIRE(swarm.size() == 20);
+    REQUIRE(swarm[15].id() == 15);
+    REQUIRE(rng.counter() == 20);
+    REQUIRE(swarm[15].position() != swarm[5].position());
+  }
+}
+
+TEST_CASE("Seeded BoidContainer Is Reproducible") {
+  boid_sim::SpawnOptions options;
+  options.seed = 99;
+  boid_sim::visualizer::BoidContainer container(300, 300, 50, options);
+  boid_sim::visualizer::BoidContainer same_container(300, 300, 50, options);
+
+  for (size_t i = 0; i < container.boids().size(); i++) {
+    REQUIRE_FALSE(container.boids()[i] != same_container.boids()[i]);
+  }
+}
@@ -0,0 +1,142 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <catch2/catch.hpp>
+
+#include "core/boid.h"
+#include "core/boid_record.h"
+#include "core/swarm_rng.h"
+#include "core/vision_cone.h"
+#include "visualizer/boid_container.h"
+
+TEST_CASE("VisionCone Tests") {
+  glm::vec2 apex(0, 0);
+  glm::vec2 heading(1, 0);
+
+  SECTION("Full Circle Sees Everything") {
+    boid_sim::VisionCone cone(apex, heading, 360.0f);
+
+    REQUIRE(cone.is_full());
+    REQUIRE(cone.Contains(glm::vec2(-5, 0)));
+    REQUIRE(cone.MayOverlapCell(glm::vec2(-20, -5), 10.0f));
+  }
+
+  SECTION("Zero Heading Sees Everything") {
+    boid_sim::VisionCone cone(apex, glm::vec2(0, 0), 90.0f);
+    REQUIRE(cone.is_full());
+  }
+
+  SECTION("Narrow Cone") {
+    boid_sim::VisionCone cone(apex, heading, 90.0f);
+
+    REQUIRE(cone.Contains(glm::vec2(10, 9)));
+    REQUIRE_FALSE(cone.Contains(glm::vec2(10, 11)));
+    REQUIRE_FALSE(cone.Contains(glm::vec2(-1, 0)));
+    REQUIRE_FALSE(cone.MayOverlapCell(glm::vec2(-20, -5), 10.0f));
+    REQUIRE_FALSE(cone.MayOverlapCell(glm::vec2(0, 20), 10.0f));
+    REQUIRE(cone.MayOverlapCell(glm::vec2(10, -5), 10.0f));
+  }
+
+  SECTION("Wide Cone With a Blind Spot") {
+    boid_sim::VisionCone cone(apex, heading, 270.0f);
+
+    REQUIRE(cone.Contains(glm::vec2(0, 10)));
+    REQUIRE(cone.Contains(glm::vec2(-10, 11)));
+    REQUIRE_FALSE(cone.Contains(glm::vec2(-10, 9)));
+    REQUIRE_FALSE(cone.MayOverlapCell(glm::vec2(-30, -2), 4.0f));
+    REQUIRE(cone.MayOverlapCell(glm::vec2(-30, 40), 4.0f));
+  }
+
+  SECTION("Cells Holding a Visible Point Are Never Skipped") {
+    boid_sim::SwarmRng rng(5);
+
+    for (uint64_t trial = 0; trial < 3000; trial++) {
+      glm::vec2 cone_apex(rng.Uniform(trial, 0, -50, 50),
+                          rng.Uniform(trial, 1, -50, 50));
+      glm::vec2 cone_heading(rng.Uniform(trial, 2, -1, 1),
+                             rng.Uniform(trial, 3, -1, 1));
+      float view_angle = rng.Uniform(trial, 4, 0, 360);
+      glm::vec2 corner(rng.Uniform(trial, 5, -80, 70),
+                       rng.Uniform(trial, 6, -80, 70));
+      float size = rng.Uniform(trial, 7, 1, 20);
+      boid_sim::VisionCone cone(cone_apex, cone_heading, view_angle);
+
+      for (uint32_t sample = 0; sample < 16; sample++) {
+        glm::vec2 point =
+            corner + size * glm::vec2(rng.Uniform(trial, 8 + 2 * sample),
+                                      rng.Uniform(trial, 9 + 2 * sample));
+        if (cone.Contains(point)) {
+          REQUIRE(cone.MayOverlapCell(corner, size));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Boid View Angle") {
+  glm::vec2 position(0, 0);
+  glm::vec2 direction(1, 0);
+  boid_sim::Boid boid(0, position, direction);
+
+  SECTION("Defaults to a Full Circle") {
+    REQUIRE(boid.view_angle() == 360.0f);
+  }
+
+  SECTION("Rejects Angles Outside 0 to 360") {
+    REQUIRE_THROWS_AS(boid.set_view_angle(-1.0f), std::invalid_argument);
+    REQUIRE_THROWS_AS(boid.set_view_angle(400.0f), std::invalid_argument);
+  }
+
+  SECTION("Survives a Record Round Trip") {
+    boid.set_view_angle(210.0f);
+    REQUIRE(boid_sim::FromRecord(boid_sim::ToRecord(boid)).view_angle() ==
+            210.0f);
+  }
+}
+
+TEST_CASE("Vision Cones Match the Brute Force Reference") {
+  size_t num_frames = 30;
+  glm::vec2 mouse_pos(0, 0);
+  boid_sim::SpawnOptions options;
+  options.seed = 808;
+  options.distribution = boid_sim::SpawnDistribution::kClustered;
+
+  for (float view_angle : {300.0f, 180.0f, 100.0f}) {
+    boid_sim::FlockingParams params;
+    params.view_angle = view_angle;
+
+    for (bool unbounded : {false, true}) {
+      boid_sim::visualizer::BoidContainer reference(400, 300, 300, options,
+                                                    params);
+      std::vector<boid_sim::Boid> expected = reference.boids();
+      std::vector<std::vector<float>> bounds;
+      if (!unbounded) {
+        bounds = reference.container_bounds();
+      }
+
+      for (size_t frame = 0; frame < num_frames; frame++) {
+        std::vector<boid_sim::Boid> snapshot = expected;
+
+        for (boid_sim::Boid &boid : expected) {
+          boid.UpdatePosition(bounds, snapshot, mouse_pos,
+                              params.align_percent, params.cohesion_percent,
+                              params.separation_percent);
+        }
+      }
+
+      for (size_t num_threads : {1, 4}) {
+        boid_sim::visualizer::BoidContainer container(400, 300, 300, options,
+                                                      params);
+        container.set_unbounded(unbounded);
+        container.set_num_threads(num_threads);
+
+        for (size_t frame = 0; frame < num_frames; frame++) {
+          container.AdvanceOnFrame(mouse_pos);
+        }
+
+        REQUIRE(boid_sim::HashSwarm(container.boids()) ==
+                boid_sim::HashSwarm(expected));
+      }
+    }
+  }
+}
@@ -0,0 +1,107 @@
+//
+// Created by Kaelan Davis on 10/19/2026.
+//
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "core/work_stealing_scheduler.h"
+
+TEST_CASE("WorkStealingScheduler Tests") {
+  std::vector<size_t> task_costs{5, 1, 1, 9, 3, 1, 1, 2, 7, 1, 1, 4, 1, 1};
+
+  SECTION("Every Task Runs Exactly Once") {
+    for (size_t num_workers : {1, 2, 3, 8}) {
+      boid_sim::WorkStealingScheduler scheduler(num_workers);
+      std::vector<std::atomic<size_t>> runs(task_costs.size());
+      for (std::atomic<size_t> &count : runs) {
+        count.store(0);
+      }
+
+      // Catch assertions are not thread safe, so check afterwards
+      std::atomic<size_t> bad_workers(0);
+      scheduler.Run(task_costs, [&](size_t task, size_t worker) {
+        if (worker >= num_workers) {
+          bad_workers++;
+        }
+        runs[task]++;
+      });
+
+      REQUIRE(bad_workers.load() == 0);
+
+      for (std::atomic<size_t> &count : runs) {
+        REQUIRE(count.load() == 1);
+      }
+    }
+  }
+
+  SECTION("Single Worker Runs Tasks in Order on the Caller") {
+    boid_sim::WorkStealingScheduler scheduler;
+    std::vector<size_t> order;
+
+    scheduler.Run(task_costs, [&](size_t task, size_t worker) {
+      REQUIRE(worker == 0);
+      order.push_back(task);
+    });
+
+    REQUIRE(order.size() == task_costs.size());
+    for (size_t task = 0; task < order.size(); task++) {
+      REQUIRE(order[task] == task);
+    }
+    REQUIRE(scheduler.num_steals() == 0);
+  }
+
+  SECTION("Idle Workers Steal From a Stalled Worker") {
+    // Every estimate is equal, but the first task takes far longer
+    std::vector<size_t> even_costs(16, 1);
+    boid_sim::WorkStealingScheduler scheduler(2);
+    std::atomic<size_t> num_run(0);
+
+    scheduler.Run(even_costs, [&](size_t task, size_t) {
+      if (task == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      }
+      num_run++;
+    });
+
+    REQUIRE(num_run.load() == even_costs.size());
+    REQUIRE(scheduler.num_steals() > 0);
+  }
+
+  SECTION("Workers Are Kept Between Runs") {
+    boid_sim::WorkStealingScheduler scheduler(3);
+    std::mutex lock;
+    std::set<std::thread::id> threads;
+
+    for (size_t run = 0; run < 50; run++) {
+      scheduler.Run(task_costs, [&](size_t, size_t) {
+        std::lock_guard<std::mutex> guard(lock);
+        threads.insert(std::this_thread::get_id());
+      });
+    }
+
+    REQUIRE(threads.size() <= 3);
+
+    // Resized and copied schedulers start workers of their own
+    scheduler.set_num_workers(5);
+    boid_sim::WorkStealingScheduler copy = scheduler;
+    std::atomic<size_t> num_run(0);
+
+    for (size_t run = 0; run < 10; run++) {
+      scheduler.Run(task_costs, [&](size_t, size_t) { num_run++; });
+      copy.Run(task_costs, [&](size_t, size_t) { num_run++; });
+    }
+
+    REQUIRE(copy.num_workers() == 5);
+    REQUIRE(num_run.load() == 20 * task_costs.size());
+  }
+
+  SECTION("Empty Batch") {
+    boid_sim::WorkStealingScheduler scheduler(4);
+    scheduler.Run(std::vector<size_t>(), [](size_t, size_t) { FAIL(); });
+    REQUIRE(scheduler.num_steals() == 0);
+  }
+}